@@ -29,9 +29,11 @@
 #include <sys/ioctl.h>
 #endif
 
+#include <algorithm>
 #include <cctype>
 #include <limits>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "kahypar/kahypar.h"
@@ -87,6 +89,16 @@ po::options_description createGeneralOptionsDescription(Context& context, const
     ("vcycles",
     po::value<uint32_t>(&context.partition.global_search_iterations)->value_name("<uint32_t>"),
     "# V-cycle iterations for direct k-way partitioning")
+    ("threads",
+    po::value<size_t>(&context.partition.num_threads)->value_name("<size_t>")->notifier(
+      [&](const size_t) {
+      if (context.partition.num_threads == 0) {
+        context.partition.num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+      }
+    }),
+    "Number of threads used for parallel recursive bisection, time-limited repeated\n"
+    "partitioning and the evolutionary island model (0 = all available cores)\n"
+    "(default: 1)")
     ("use-individual-part-weights",
     po::value<bool>(&context.partition.use_individual_part_weights)->value_name("<bool>"),
     "# Use individual part weights specified with --partweights= option")
@@ -134,6 +146,8 @@ po::options_description createFlowRefinementOptionsDescription(Context& context,
     "Flow Algorithms:\n"
     " - edmond_karp       : Edmond-Karp Max-Flow algorithm\n"
     " - goldberg_tarjan   : GoldbergTarjan Max-Flow algorithm\n"
+    " - parallel_push_relabel : Synchronous parallel push-relabel Max-Flow algorithm\n"
+    "                           (uses --threads threads)\n"
     " - boykov_kolmogorov : Boykov-Kolmogorov Max-Flow algorithm\n"
     " - ibfs              : IBFS Max-Flow algorithm\n"
     "(default: ibfs)")
@@ -178,6 +192,11 @@ po::options_description createFlowRefinementOptionsDescription(Context& context,
     po::value<bool>((initial_partitioning ? &context.initial_partitioning.local_search.flow.use_most_balanced_minimum_cut : &context.local_search.flow.use_most_balanced_minimum_cut))->value_name("<bool>"),
     "Heuristic to balance a min-cut bipartition after a maximum flow computation \n"
     "(default: true)")
+    ((initial_partitioning ? "i-r-flow-most-balanced-minimum-cut-sweeps" : "r-flow-most-balanced-minimum-cut-sweeps"),
+    po::value<size_t>((initial_partitioning ? &context.initial_partitioning.local_search.flow.most_balanced_minimum_cut_sweeps : &context.local_search.flow.most_balanced_minimum_cut_sweeps))->value_name("<size_t>"),
+    "Number of random topological orders of the SCC DAG evaluated by the most balanced minimum cut heuristic.\n"
+    "The sweeps are evaluated in parallel if --threads > 1 \n"
+    "(default: 20)")
     ((initial_partitioning ? "i-r-flow-use-adaptive-alpha-stopping-rule" : "r-flow-use-adaptive-alpha-stopping-rule"),
     po::value<bool>((initial_partitioning ? &context.initial_partitioning.local_search.flow.use_adaptive_alpha_stopping_rule : &context.local_search.flow.use_adaptive_alpha_stopping_rule))->value_name("<bool>"),
     "Stop adaptive flow iterations, when cut equal to old cut \n"
@@ -189,7 +208,11 @@ po::options_description createFlowRefinementOptionsDescription(Context& context,
     ((initial_partitioning ? "i-r-flow-use-improvement-history" : "r-flow-use-improvement-history"),
     po::value<bool>((initial_partitioning ? &context.initial_partitioning.local_search.flow.use_improvement_history : &context.local_search.flow.use_improvement_history))->value_name("<bool>"),
     "Decides if flow-based refinement is used between two adjacent blocks based on improvement history of the corresponding blocks \n"
-    "(default: true)");
+    "(default: true)")
+    ((initial_partitioning ? "i-r-flow-use-warm-start" : "r-flow-use-warm-start"),
+    po::value<bool>((initial_partitioning ? &context.initial_partitioning.local_search.flow.use_warm_start : &context.local_search.flow.use_warm_start))->value_name("<bool>"),
+    "Start each adaptive flow iteration of a block pair with the flow of the previous iteration \n"
+    "(default: false)");
   return options;
 }
 
@@ -210,6 +233,7 @@ po::options_description createCoarseningOptionsDescription(Context& context,
     }),
     "Algorithm:\n"
     " - ml_style\n"
+    " - parallel_lp\n"
     " - heavy_full\n"
     " - heavy_lazy")
     ((initial_partitioning ? "i-c-s" : "c-s"),
@@ -317,6 +341,7 @@ po::options_description createRefinementOptionsDescription(Context& context,
     " - kway_fm_flow     : k-way FM + Flow algorithm (direct k-way       : cut)\n"
     " - kway_fm_km1      : k-way FM algorithm        (direct k-way       : km1)\n"
     " - kway_fm_flow_km1 : k-way FM + Flow algorithm (direct k-way       : km1)\n"
+    " - kway_fm_parallel_km1 : parallel k-way FM    (direct k-way       : km1)\n"
     " - kway_flow        : k-way Flow algorithm      (direct k-way       : cut & km1)")
     ((initial_partitioning ? "i-r-runs" : "r-runs"),
     po::value<int>((initial_partitioning ? &context.initial_partitioning.local_search.iterations_per_level : &context.local_search.iterations_per_level))->value_name("<int>")->notifier(
@@ -333,6 +358,10 @@ po::options_description createRefinementOptionsDescription(Context& context,
     }),
     "Max. # local search repetitions on each level\n"
     "(no limit:-1)")
+    ((initial_partitioning ? "i-r-batch-size" : "r-batch-size"),
+    po::value<size_t>((initial_partitioning ? &context.initial_partitioning.local_search.uncontraction_batch_size : &context.local_search.uncontraction_batch_size))->value_name("<size_t>"),
+    "Max. # of independent contractions that are undone at once before\n"
+    "the uncontracted hypernodes are refined together (default: 1)")
     ((initial_partitioning ? "i-r-fm-stop" : "r-fm-stop"),
     po::value<std::string>()->value_name("<string>")->notifier(
       [&context, initial_partitioning](const std::string& stopfm) {
@@ -551,7 +580,24 @@ po::options_description createEvolutionaryOptionsDescription(Context& context,
       context.evolutionary.edge_frequency_chance = edge_chance;
     }),
     "The Chance of a mutation being selected as operation\n"
-    "default: 0.5)");
+    "default: 0.5)")
+    ("migration-interval",
+    po::value<int>()->value_name("<int>")->notifier(
+      [&](const int& interval) {
+      context.evolutionary.migration_interval = interval;
+    }),
+    "Number of iterations of an island between two migrations if --threads > 1\n"
+    "(default: 10)(0 disables migration)")
+    ("migration-topology",
+    po::value<std::string>()->value_name("<string>")->notifier(
+      [&](const std::string& topology) {
+      context.evolutionary.migration_topology = kahypar::migrationTopologyFromString(topology);
+    }),
+    "Islands to which the best individual of an island migrates:\n"
+    "- ring: the next island\n"
+    "- complete: all other islands\n"
+    "- random: a randomly chosen island\n"
+    "(default: ring)");
   return evolutionary_options;
 }
 
@@ -31,7 +31,8 @@ int main(int argc, char* argv[]) {
 
   kahypar::Hypergraph hypergraph(
     kahypar::io::createHypergraphFromFile(context.partition.graph_filename,
-                                          context.partition.k));
+                                          context.partition.k,
+                                          context.partition.num_threads));
 
   kahypar::PartitionerFacade().partition(hypergraph, context);
 
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <limits>
+#include <utility>
+
+#include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/bucket_queue.h"
+#include "kahypar/macros.h"
+#include "kahypar/meta/mandatory.h"
+
+namespace kahypar {
+namespace ds {
+// Max priority queue for integer gains that uses a LinkedBucketQueue if the upper
+// bound on the absolute gain values passed at construction time is small enough
+// and falls back to a BinaryMaxHeap otherwise (e.g. for large edge weights or if
+// no bound is known, i.e. max_gain == 0).
+template <typename IDType = Mandatory,
+          typename KeyType = Mandatory,
+          typename MetaKey = std::numeric_limits<KeyType> >
+class AdaptiveGainQueue {
+  using Heap = BinaryMaxHeap<IDType, KeyType>;
+  using Buckets = LinkedBucketQueue<IDType, KeyType, MetaKey>;
+
+ public:
+  using value_type = IDType;
+  using key_type = KeyType;
+  using meta_key_type = MetaKey;
+  using data_type = void;
+
+  // Each queue of a KWayPriorityQueue allocates its own 2 * max_gain + 1 buckets.
+  // Larger gain ranges would dominate the memory footprint of the queues.
+  static constexpr KeyType kMaxBucketGain = 1 << 13;
+
+  static bool usesBuckets(const KeyType max_gain) {
+    return max_gain > 0 && max_gain <= kMaxBucketGain;
+  }
+
+  explicit AdaptiveGainQueue(const IDType max_size, const KeyType max_gain = 0) :
+    _use_buckets(usesBuckets(max_gain)),
+    _heap(_use_buckets ? 0 : max_size),
+    _buckets(_use_buckets ? max_size : 0, _use_buckets ? max_gain : 0) { }
+
+  AdaptiveGainQueue(const AdaptiveGainQueue&) = delete;
+  AdaptiveGainQueue& operator= (const AdaptiveGainQueue&) = delete;
+
+  AdaptiveGainQueue(AdaptiveGainQueue&&) = default;
+  AdaptiveGainQueue& operator= (AdaptiveGainQueue&&) = default;
+
+  ~AdaptiveGainQueue() = default;
+
+  void swap(AdaptiveGainQueue& other) {
+    using std::swap;
+    swap(_use_buckets, other._use_buckets);
+    swap(_heap, other._heap);
+    swap(_buckets, other._buckets);
+  }
+
+  bool usesBuckets() const {
+    return _use_buckets;
+  }
+
+  size_t size() const {
+    return _use_buckets ? _buckets.size() : _heap.size();
+  }
+
+  bool empty() const {
+    return _use_buckets ? _buckets.empty() : _heap.empty();
+  }
+
+  bool contains(const IDType id) const {
+    return _use_buckets ? _buckets.contains(id) : _heap.contains(id);
+  }
+
+  KeyType getKey(const IDType id) const {
+    return _use_buckets ? _buckets.getKey(id) : _heap.getKey(id);
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void push(const IDType id, const KeyType key) {
+    if (_use_buckets) {
+      _buckets.push(id, key);
+    } else {
+      _heap.push(id, key);
+    }
+  }
+
+  IDType top() const {
+    return _use_buckets ? _buckets.top() : _heap.top();
+  }
+
+  KeyType topKey() const {
+    return _use_buckets ? _buckets.topKey() : _heap.topKey();
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void pop() {
+    if (_use_buckets) {
+      _buckets.pop();
+    } else {
+      _heap.pop();
+    }
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void remove(const IDType id) {
+    if (_use_buckets) {
+      _buckets.remove(id);
+    } else {
+      _heap.remove(id);
+    }
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateKey(const IDType id, const KeyType new_key) {
+    if (_use_buckets) {
+      _buckets.updateKey(id, new_key);
+    } else {
+      _heap.updateKey(id, new_key);
+    }
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateKeyBy(const IDType id, const KeyType key_delta) {
+    if (_use_buckets) {
+      _buckets.updateKeyBy(id, key_delta);
+    } else {
+      _heap.updateKeyBy(id, key_delta);
+    }
+  }
+
+  void decreaseKey(const IDType id, const KeyType new_key) {
+    updateKey(id, new_key);
+  }
+
+  void increaseKey(const IDType id, const KeyType new_key) {
+    updateKey(id, new_key);
+  }
+
+  void decreaseKeyBy(const IDType id, const KeyType key_delta) {
+    updateKeyBy(id, -key_delta);
+  }
+
+  void increaseKeyBy(const IDType id, const KeyType key_delta) {
+    updateKeyBy(id, key_delta);
+  }
+
+  void clear() {
+    if (_use_buckets) {
+      _buckets.clear();
+    } else {
+      _heap.clear();
+    }
+  }
+
+ private:
+  bool _use_buckets;
+  Heap _heap;
+  Buckets _buckets;
+};
+
+template <typename IDType,
+          typename KeyType,
+          typename MetaKey>
+void swap(AdaptiveGainQueue<IDType, KeyType, MetaKey>& a,
+          AdaptiveGainQueue<IDType, KeyType, MetaKey>& b) {
+  a.swap(b);
+}
+}  // namespace ds
+}  // namespace kahypar
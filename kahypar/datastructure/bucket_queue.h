@@ -21,6 +21,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <limits>
 #include <memory>
@@ -260,7 +261,13 @@ class EnhancedBucketQueue {
     ASSERT(_contains[id], V(id));
     const KeyType old_address = old_key + _key_range;
     // We allow this for testcases that check that node ordering is changed on 0-delta gain updates
-    // ASSERT(new_address != old_address, V(new_address));
+    if (new_address == old_address) {
+      // The element becomes the last one in its bucket. Going through the general
+      // case would invalidate the bucket if it only contains this element.
+      swapElementWithLastElement(id, old_address, in_bucket_index);
+      _repository[id] = { _buckets[old_address].size() - 1, new_key };
+      return;
+    }
 
     if (!_valid[new_address]) {
       ASSERT(_index.find(new_address) == _index.end(), V(new_address));
@@ -310,5 +317,244 @@ void swap(EnhancedBucketQueue<IDType, KeyType, MetaKey>& a,
           EnhancedBucketQueue<IDType, KeyType, MetaKey>& b) {
   a.swap(b);
 }
+
+// Bucket priority queue for bounded integer keys. Each bucket is an intrusive doubly-linked
+// list threaded through the element array, so that push, remove and key updates take
+// constant time and do not allocate. All data of an element is kept in one record and
+// elements/buckets carry a timestamp, which makes clear() O(1). The max pointer only moves
+// down lazily when the top bucket runs empty. Keys outside [-max_gain, max_gain] are stored
+// exactly, but are kept in the respective boundary bucket.
+template <typename IDType = Mandatory,
+          typename KeyType = Mandatory,
+          typename MetaKey = std::numeric_limits<KeyType> >
+class LinkedBucketQueue {
+ private:
+  using Timestamp = uint32_t;
+  static constexpr IDType kInvalidID = std::numeric_limits<IDType>::max();
+
+  struct Element {
+    KeyType key;
+    IDType next;
+    IDType prev;
+    Timestamp timestamp;
+  };
+
+  struct Bucket {
+    IDType head;
+    Timestamp timestamp;
+  };
+
+ public:
+  using value_type = IDType;
+  using key_type = KeyType;
+  using meta_key_type = MetaKey;
+  using data_type = void;
+
+  LinkedBucketQueue(const IDType max_size, const KeyType max_gain) :
+    _num_elements(0),
+    _max_gain(max_gain),
+    _max_address(0),
+    _timestamp(1),
+    _num_buckets(2 * static_cast<size_t>(max_gain) + 1),
+    _max_size(max_size),
+    _elements(std::make_unique<Element[]>(max_size)),
+    _buckets(std::make_unique<Bucket[]>(_num_buckets)) {
+    static_assert(std::is_integral<KeyType>::value, "Integer required.");
+    ASSERT(max_gain >= 0, V(max_gain));
+    resetTimestamps();
+  }
+
+  LinkedBucketQueue(const LinkedBucketQueue&) = delete;
+  LinkedBucketQueue& operator= (const LinkedBucketQueue&) = delete;
+
+  LinkedBucketQueue(LinkedBucketQueue&&) = default;
+  LinkedBucketQueue& operator= (LinkedBucketQueue&&) = default;
+
+  ~LinkedBucketQueue() = default;
+
+  void swap(LinkedBucketQueue& other) {
+    using std::swap;
+    swap(_num_elements, other._num_elements);
+    swap(_max_gain, other._max_gain);
+    swap(_max_address, other._max_address);
+    swap(_timestamp, other._timestamp);
+    swap(_num_buckets, other._num_buckets);
+    swap(_max_size, other._max_size);
+    swap(_elements, other._elements);
+    swap(_buckets, other._buckets);
+  }
+
+  size_t size() const {
+    return _num_elements;
+  }
+
+  bool empty() const {
+    return _num_elements == 0;
+  }
+
+  bool contains(const IDType id) const {
+    return _elements[id].timestamp == _timestamp;
+  }
+
+  KeyType getKey(const IDType id) const {
+    ASSERT(contains(id), V(id));
+    return _elements[id].key;
+  }
+
+  void push(const IDType id, const KeyType key) {
+    ASSERT(!contains(id), V(id));
+    _elements[id].key = key;
+    _elements[id].timestamp = _timestamp;
+    const size_t address = toAddress(key);
+    link(id, address);
+    if (_num_elements == 0 || address > _max_address) {
+      _max_address = address;
+    }
+    ++_num_elements;
+  }
+
+  IDType top() const {
+    ASSERT(!empty(), "BucketQueue is empty");
+    ASSERT(head(_max_address) != kInvalidID, V(_max_address));
+    return _buckets[_max_address].head;
+  }
+
+  KeyType topKey() const {
+    ASSERT(!empty(), "BucketQueue is empty");
+    // Only the boundary buckets can contain elements with different keys.
+    const KeyType key = static_cast<KeyType>(_max_address) - _max_gain;
+    return key == _max_gain || key == -_max_gain ? _elements[top()].key : key;
+  }
+
+  void pop() {
+    remove(top());
+  }
+
+  void remove(const IDType id) {
+    ASSERT(contains(id), V(id));
+    unlink(id);
+    _elements[id].timestamp = 0;
+    --_num_elements;
+    updateMaxAddress();
+  }
+
+  void updateKey(const IDType id, const KeyType new_key) {
+    ASSERT(contains(id), V(id));
+    const size_t address = toAddress(new_key);
+    if (address == toAddress(_elements[id].key)) {
+      // In contrast to EnhancedBucketQueue, elements keep their position in the bucket.
+      _elements[id].key = new_key;
+      return;
+    }
+    unlink(id);
+    _elements[id].key = new_key;
+    link(id, address);
+    if (address > _max_address) {
+      _max_address = address;
+    } else {
+      updateMaxAddress();
+    }
+  }
+
+  void updateKeyBy(const IDType id, const KeyType key_delta) {
+    updateKey(id, _elements[id].key + key_delta);
+  }
+
+  void decreaseKey(const IDType id, const KeyType new_key) {
+    updateKey(id, new_key);
+  }
+
+  void increaseKey(const IDType id, const KeyType new_key) {
+    updateKey(id, new_key);
+  }
+
+  void decreaseKeyBy(const IDType id, const KeyType key_delta) {
+    updateKey(id, _elements[id].key - key_delta);
+  }
+
+  void increaseKeyBy(const IDType id, const KeyType key_delta) {
+    updateKey(id, _elements[id].key + key_delta);
+  }
+
+  void clear() {
+    _num_elements = 0;
+    _max_address = 0;
+    if (_timestamp == std::numeric_limits<Timestamp>::max()) {
+      resetTimestamps();
+    } else {
+      ++_timestamp;
+    }
+  }
+
+ private:
+  void resetTimestamps() {
+    for (size_t i = 0; i < _max_size; ++i) {
+      _elements[i].timestamp = 0;
+    }
+    for (size_t i = 0; i < _num_buckets; ++i) {
+      _buckets[i].timestamp = 0;
+    }
+    _timestamp = 1;
+  }
+
+  size_t toAddress(const KeyType key) const {
+    return static_cast<size_t>(std::max(-_max_gain, std::min(key, _max_gain)) + _max_gain);
+  }
+
+  IDType head(const size_t address) const {
+    return _buckets[address].timestamp == _timestamp ? _buckets[address].head : kInvalidID;
+  }
+
+  // Elements are prepended to their bucket, i.e., ties are broken in LIFO order.
+  void link(const IDType id, const size_t address) {
+    const IDType first = head(address);
+    _elements[id].next = first;
+    _elements[id].prev = kInvalidID;
+    if (first != kInvalidID) {
+      _elements[first].prev = id;
+    }
+    _buckets[address] = { id, _timestamp };
+  }
+
+  void unlink(const IDType id) {
+    const Element& element = _elements[id];
+    if (element.next != kInvalidID) {
+      _elements[element.next].prev = element.prev;
+    }
+    if (element.prev != kInvalidID) {
+      _elements[element.prev].next = element.next;
+    } else {
+      const size_t address = toAddress(element.key);
+      ASSERT(head(address) == id, V(id));
+      _buckets[address].head = element.next;
+    }
+  }
+
+  void updateMaxAddress() {
+    if (_num_elements > 0) {
+      while (head(_max_address) == kInvalidID) {
+        ASSERT(_max_address > 0, "No non-empty bucket found");
+        --_max_address;
+      }
+    }
+  }
+
+  size_t _num_elements;
+  KeyType _max_gain;
+  size_t _max_address;
+  Timestamp _timestamp;
+  size_t _num_buckets;
+  size_t _max_size;
+  std::unique_ptr<Element[]> _elements;
+  std::unique_ptr<Bucket[]> _buckets;
+};
+
+template <typename IDType,
+          typename KeyType,
+          typename MetaKey>
+void swap(LinkedBucketQueue<IDType, KeyType, MetaKey>& a,
+          LinkedBucketQueue<IDType, KeyType, MetaKey>& b) {
+  a.swap(b);
+}
 }  // namespace ds
 }  // namespace kahypar
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "kahypar/macros.h"
+#include "kahypar/meta/mandatory.h"
+
+namespace kahypar {
+namespace ds {
+// Immutable set of IDs in [0, universe_size). Depending on the density of the set,
+// it is either stored as sorted array of IDs or as bitmap with one bit per ID,
+// whichever needs less memory. Symmetric differences of two bitmaps are computed
+// word-wise using popcount.
+template <typename IDType = Mandatory>
+class CompressedBitmap {
+  using Word = uint64_t;
+  static constexpr size_t kBitsPerWord = std::numeric_limits<Word>::digits;
+
+ public:
+  CompressedBitmap() :
+    _universe_size(0),
+    _size(0),
+    _elements(),
+    _words() { }
+
+  // The elements have to be sorted and must not contain duplicates.
+  CompressedBitmap(const std::vector<IDType>& elements, const size_t universe_size) :
+    _universe_size(universe_size),
+    _size(elements.size()),
+    _elements(),
+    _words() {
+    ASSERT(std::is_sorted(elements.begin(), elements.end()));
+    ASSERT(std::adjacent_find(elements.begin(), elements.end()) == elements.end());
+    ASSERT(elements.empty() || elements.back() < universe_size);
+    const size_t num_words = (universe_size + kBitsPerWord - 1) / kBitsPerWord;
+    if (num_words * sizeof(Word) < elements.size() * sizeof(IDType)) {
+      _words.resize(num_words, 0);
+      for (const IDType& id : elements) {
+        _words[id / kBitsPerWord] |= Word(1) << (id % kBitsPerWord);
+      }
+    } else {
+      _elements = elements;
+      _elements.shrink_to_fit();
+    }
+  }
+
+  CompressedBitmap(const CompressedBitmap&) = default;
+  CompressedBitmap& operator= (const CompressedBitmap&) = default;
+
+  CompressedBitmap(CompressedBitmap&&) = default;
+  CompressedBitmap& operator= (CompressedBitmap&&) = default;
+
+  ~CompressedBitmap() = default;
+
+  size_t size() const {
+    return _size;
+  }
+
+  bool empty() const {
+    return _size == 0;
+  }
+
+  bool isBitmap() const {
+    return !_words.empty();
+  }
+
+  size_t sizeInBytes() const {
+    return _elements.size() * sizeof(IDType) + _words.size() * sizeof(Word);
+  }
+
+  bool contains(const IDType id) const {
+    ASSERT(id < _universe_size);
+    if (isBitmap()) {
+      return (_words[id / kBitsPerWord] >> (id % kBitsPerWord)) & 1;
+    }
+    return std::binary_search(_elements.begin(), _elements.end(), id);
+  }
+
+  std::vector<IDType> elements() const {
+    if (!isBitmap()) {
+      return _elements;
+    }
+    std::vector<IDType> elements;
+    elements.reserve(_size);
+    for (size_t i = 0; i < _words.size(); ++i) {
+      Word word = _words[i];
+      while (word != 0) {
+        elements.push_back(i * kBitsPerWord + __builtin_ctzll(word));
+        word &= word - 1;
+      }
+    }
+    return elements;
+  }
+
+  size_t symmetricDifferenceSize(const CompressedBitmap& other) const {
+    ASSERT(_universe_size == other._universe_size);
+    if (isBitmap() && other.isBitmap()) {
+      size_t difference = 0;
+      for (size_t i = 0; i < _words.size(); ++i) {
+        difference += __builtin_popcountll(_words[i] ^ other._words[i]);
+      }
+      return difference;
+    } else if (isBitmap() || other.isBitmap()) {
+      const CompressedBitmap& bitmap = isBitmap() ? *this : other;
+      const CompressedBitmap& array = isBitmap() ? other : *this;
+      size_t intersection = 0;
+      for (const IDType& id : array._elements) {
+        intersection += bitmap.contains(id);
+      }
+      return bitmap._size + array._size - 2 * intersection;
+    }
+    size_t intersection = 0;
+    auto lhs = _elements.begin();
+    auto rhs = other._elements.begin();
+    while (lhs != _elements.end() && rhs != other._elements.end()) {
+      if (*lhs < *rhs) {
+        ++lhs;
+      } else if (*rhs < *lhs) {
+        ++rhs;
+      } else {
+        ++intersection;
+        ++lhs;
+        ++rhs;
+      }
+    }
+    return _size + other._size - 2 * intersection;
+  }
+
+ private:
+  size_t _universe_size;
+  size_t _size;
+  std::vector<IDType> _elements;
+  std::vector<Word> _words;
+};
+}  // namespace ds
+}  // namespace kahypar
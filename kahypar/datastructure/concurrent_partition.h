@@ -0,0 +1,272 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "kahypar/macros.h"
+#include "kahypar/meta/mandatory.h"
+
+namespace kahypar {
+namespace ds {
+/*!
+ * Partition layer on top of a GenericHypergraph that can be modified by multiple
+ * threads at the same time. The hypergraph itself is only read, i.e., its structure
+ * must not change (no (un)contractions) while the layer is in use.
+ *
+ * Block ids, block weights and the pin counts \f$\Phi(e, V_i)\f$ are stored in atomics.
+ * The connectivity set \f$\Lambda(e)\f$ of each hyperedge is a bitset that is kept
+ * consistent with the pin counts without locks. While moves are in flight, the
+ * connectivity of a hyperedge might be outdated for a short time, but as soon as
+ * all concurrent moves are finished, it reflects the pin counts again.
+ *
+ * Moves report the pin counts of each incident hyperedge after the move
+ * (see changeNodePart), which is sufficient to derive gain deltas for
+ * the cut and the (connectivity - 1) metric.
+ */
+template <typename Hypergraph = Mandatory>
+class ConcurrentPartition {
+ private:
+  using HypernodeID = typename Hypergraph::HypernodeID;
+  using HyperedgeID = typename Hypergraph::HyperedgeID;
+  using HypernodeWeight = typename Hypergraph::HypernodeWeight;
+  using HyperedgeWeight = typename Hypergraph::HyperedgeWeight;
+  using PartitionID = typename Hypergraph::PartitionID;
+  using Bitset = std::uint64_t;
+
+  static constexpr PartitionID kBitsPerWord = std::numeric_limits<Bitset>::digits;
+
+ public:
+  explicit ConcurrentPartition(const Hypergraph& hypergraph) :
+    _hg(hypergraph),
+    _k(hypergraph.k()),
+    _words_per_hyperedge((_k + kBitsPerWord - 1) / kBitsPerWord),
+    _part_ids(std::make_unique<std::atomic<PartitionID>[]>(hypergraph.initialNumNodes())),
+    _part_weights(std::make_unique<std::atomic<HypernodeWeight>[]>(_k)),
+    _part_sizes(std::make_unique<std::atomic<HypernodeID>[]>(_k)),
+    _pins_in_part(std::make_unique<std::atomic<HypernodeID>[]>(
+                    static_cast<size_t>(hypergraph.initialNumEdges()) * _k)),
+    _connectivity_sets(std::make_unique<std::atomic<Bitset>[]>(
+                         static_cast<size_t>(hypergraph.initialNumEdges()) * _words_per_hyperedge)) {
+    initialize();
+  }
+
+  ConcurrentPartition(const ConcurrentPartition&) = delete;
+  ConcurrentPartition& operator= (const ConcurrentPartition&) = delete;
+
+  ConcurrentPartition(ConcurrentPartition&&) = default;
+  ConcurrentPartition& operator= (ConcurrentPartition&&) = delete;
+
+  ~ConcurrentPartition() = default;
+
+  // ! Copies the current partition of the hypergraph. Must not be called concurrently.
+  void initialize() {
+    for (PartitionID i = 0; i < _k; ++i) {
+      _part_weights[i].store(_hg.partWeight(i), std::memory_order_relaxed);
+      _part_sizes[i].store(_hg.partSize(i), std::memory_order_relaxed);
+    }
+    for (const HypernodeID& hn : _hg.nodes()) {
+      _part_ids[hn].store(_hg.partID(hn), std::memory_order_relaxed);
+    }
+    for (const HyperedgeID& he : _hg.edges()) {
+      for (size_t i = 0; i < _words_per_hyperedge; ++i) {
+        _connectivity_sets[static_cast<size_t>(he) * _words_per_hyperedge + i].store(
+          0, std::memory_order_relaxed);
+      }
+      for (PartitionID i = 0; i < _k; ++i) {
+        const HypernodeID pin_count = _hg.pinCountInPart(he, i);
+        _pins_in_part[static_cast<size_t>(he) * _k + i].store(pin_count,
+                                                              std::memory_order_relaxed);
+        if (pin_count > 0) {
+          connectivityWord(he, i).fetch_or(bit(i), std::memory_order_relaxed);
+        }
+      }
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  // ! Transfers the partition to the hypergraph. Must not be called concurrently.
+  void applyTo(Hypergraph& hypergraph) const {
+    ASSERT(&hypergraph == &_hg, "Partition belongs to a different hypergraph");
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      const PartitionID part = partID(hn);
+      if (hypergraph.partID(hn) != part) {
+        hypergraph.changeNodePart(hn, hypergraph.partID(hn), part);
+      }
+    }
+  }
+
+  PartitionID k() const {
+    return _k;
+  }
+
+  PartitionID partID(const HypernodeID hn) const {
+    return _part_ids[hn].load(std::memory_order_relaxed);
+  }
+
+  HypernodeWeight partWeight(const PartitionID id) const {
+    ASSERT(id < _k && id != Hypergraph::kInvalidPartition, "Part ID" << id << "out of bounds!");
+    return _part_weights[id].load(std::memory_order_relaxed);
+  }
+
+  HypernodeID partSize(const PartitionID id) const {
+    ASSERT(id < _k && id != Hypergraph::kInvalidPartition, "Part ID" << id << "out of bounds!");
+    return _part_sizes[id].load(std::memory_order_relaxed);
+  }
+
+  // ! Returns the number of pins hyperedge he has in block id.
+  HypernodeID pinCountInPart(const HyperedgeID he, const PartitionID id) const {
+    ASSERT(id < _k && id != Hypergraph::kInvalidPartition, "Part ID" << id << "out of bounds!");
+    return _pins_in_part[static_cast<size_t>(he) * _k + id].load(std::memory_order_relaxed);
+  }
+
+  // ! Returns true if block id is contained in the connectivity set of hyperedge he.
+  bool isConnected(const HyperedgeID he, const PartitionID id) const {
+    return connectivityWord(he, id).load(std::memory_order_relaxed) & bit(id);
+  }
+
+  // ! Returns the cardinality of the connectivity set of hyperedge he.
+  PartitionID connectivity(const HyperedgeID he) const {
+    PartitionID connectivity = 0;
+    for (size_t i = 0; i < _words_per_hyperedge; ++i) {
+      connectivity += __builtin_popcountll(
+        _connectivity_sets[static_cast<size_t>(he) * _words_per_hyperedge + i].load(
+          std::memory_order_relaxed));
+    }
+    return connectivity;
+  }
+
+  // ! Calls f(id) for each block id in the connectivity set of hyperedge he.
+  template <typename F>
+  void forEachConnectedBlock(const HyperedgeID he, const F& f) const {
+    for (size_t i = 0; i < _words_per_hyperedge; ++i) {
+      Bitset word = _connectivity_sets[static_cast<size_t>(he) * _words_per_hyperedge + i].load(
+        std::memory_order_relaxed);
+      while (word != 0) {
+        f(static_cast<PartitionID>(i * kBitsPerWord + __builtin_ctzll(word)));
+        word &= word - 1;
+      }
+    }
+  }
+
+  bool changeNodePart(const HypernodeID hn, const PartitionID from, const PartitionID to) {
+    return changeNodePart(hn, from, to, std::numeric_limits<HypernodeWeight>::max(),
+                          [](const HyperedgeID, const HyperedgeWeight, const HypernodeID,
+                             const HypernodeID, const HypernodeID) { });
+  }
+
+  /*!
+   * Moves hypernode hn from block from to block to. The move is rejected if hn is not in
+   * block from anymore (e.g. because another thread moved it) or if the weight of block
+   * to would exceed max_weight_to.
+   *
+   * For each incident hyperedge he, delta is called with
+   * (he, edge weight, edge size, \f$\Phi(he, from)\f$ after the move, \f$\Phi(he, to)\f$
+   * after the move). A pin count of 0 in from means that he left block from, a pin
+   * count of 1 in to means that he became connected to block to.
+   *
+   * \return true if the move was performed
+   */
+  template <typename DeltaFunc>
+  bool changeNodePart(const HypernodeID hn, const PartitionID from, const PartitionID to,
+                      const HypernodeWeight max_weight_to, const DeltaFunc& delta) {
+    ASSERT(from < _k && from != Hypergraph::kInvalidPartition, "Invalid from_part:" << from);
+    ASSERT(to < _k && to != Hypergraph::kInvalidPartition, "Invalid to_part:" << to);
+    ASSERT(from != to, "from part" << from << "==" << to << "part");
+    ASSERT(!_hg.isFixedVertex(hn), "Hypernode " << hn << " is a fixed vertex");
+    const HypernodeWeight weight = _hg.nodeWeight(hn);
+    if (_part_weights[to].fetch_add(weight, std::memory_order_relaxed) + weight > max_weight_to) {
+      _part_weights[to].fetch_sub(weight, std::memory_order_relaxed);
+      return false;
+    }
+    PartitionID expected = from;
+    if (!_part_ids[hn].compare_exchange_strong(expected, to, std::memory_order_acq_rel)) {
+      _part_weights[to].fetch_sub(weight, std::memory_order_relaxed);
+      return false;
+    }
+    _part_weights[from].fetch_sub(weight, std::memory_order_relaxed);
+    _part_sizes[from].fetch_sub(1, std::memory_order_relaxed);
+    _part_sizes[to].fetch_add(1, std::memory_order_relaxed);
+
+    for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+      const HypernodeID pin_count_in_from_part_after =
+        _pins_in_part[static_cast<size_t>(he) * _k + from].fetch_sub(1) - 1;
+      const HypernodeID pin_count_in_to_part_after =
+        _pins_in_part[static_cast<size_t>(he) * _k + to].fetch_add(1) + 1;
+      ASSERT(pin_count_in_from_part_after != std::numeric_limits<HypernodeID>::max(),
+             "HE" << he << "does not have any pins in partition" << from);
+      if (pin_count_in_from_part_after == 0) {
+        updateConnectivitySet(he, from);
+      }
+      if (pin_count_in_to_part_after == 1) {
+        updateConnectivitySet(he, to);
+      }
+      delta(he, _hg.edgeWeight(he), _hg.edgeSize(he),
+            pin_count_in_from_part_after, pin_count_in_to_part_after);
+    }
+    return true;
+  }
+
+ private:
+  static Bitset bit(const PartitionID id) {
+    return static_cast<Bitset>(1) << (id % kBitsPerWord);
+  }
+
+  std::atomic<Bitset>& connectivityWord(const HyperedgeID he, const PartitionID id) const {
+    return _connectivity_sets[static_cast<size_t>(he) * _words_per_hyperedge + id / kBitsPerWord];
+  }
+
+  // Sets the bit of block id if he has pins in id and clears it otherwise. If another
+  // thread changed the pin count from/to zero in the meantime, we have to repeat the
+  // update. This guarantees that the last bit update of a hyperedge always matches the
+  // final pin count.
+  void updateConnectivitySet(const HyperedgeID he, const PartitionID id) {
+    std::atomic<Bitset>& word = connectivityWord(he, id);
+    std::atomic<HypernodeID>& pin_count = _pins_in_part[static_cast<size_t>(he) * _k + id];
+    bool connected = pin_count.load() > 0;
+    while (true) {
+      if (connected) {
+        word.fetch_or(bit(id));
+      } else {
+        word.fetch_and(~bit(id));
+      }
+      const bool still_connected = pin_count.load() > 0;
+      if (still_connected == connected) {
+        break;
+      }
+      connected = still_connected;
+    }
+  }
+
+  const Hypergraph& _hg;
+  const PartitionID _k;
+  const size_t _words_per_hyperedge;
+  std::unique_ptr<std::atomic<PartitionID>[]> _part_ids;
+  std::unique_ptr<std::atomic<HypernodeWeight>[]> _part_weights;
+  std::unique_ptr<std::atomic<HypernodeID>[]> _part_sizes;
+  std::unique_ptr<std::atomic<HypernodeID>[]> _pins_in_part;
+  std::unique_ptr<std::atomic<Bitset>[]> _connectivity_sets;
+};
+}  // namespace ds
+}  // namespace kahypar
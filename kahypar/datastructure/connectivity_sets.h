@@ -20,6 +20,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -34,19 +37,100 @@ template <typename PartitionID = Mandatory,
 class ConnectivitySets final {
  private:
   using Byte = char;
+  using Word = std::uint64_t;
 
+  static constexpr PartitionID kBitsPerWord = std::numeric_limits<Word>::digits;
+
+ public:
+  // Up to this number of blocks, connectivity sets are stored as bitsets.
+  static constexpr PartitionID kMaxBitsetK = 256;
+
+  // Iterates over the blocks of a connectivity set. For dense connectivity sets,
+  // this is a pointer into the array of blocks, for bitsets it iterates over the set bits.
+  class ConnectivitySetIterator :
+    public std::iterator<std::forward_iterator_tag,    // iterator_category
+                         PartitionID,   // value_type
+                         std::ptrdiff_t,   // difference_type
+                         const PartitionID*,   // pointer
+                         PartitionID>{   // reference
  public:
+    explicit ConnectivitySetIterator(const PartitionID* dense) :
+      _dense(dense),
+      _word(nullptr),
+      _end(nullptr),
+      _current(0),
+      _base(0) { }
+
+    ConnectivitySetIterator(const Word* word, const Word* end) :
+      _dense(nullptr),
+      _word(word),
+      _end(end),
+      _current(word != end ? *word : 0),
+      _base(0) {
+      skipEmptyWords();
+    }
+
+    PartitionID operator* () const {
+      return _dense != nullptr ? *_dense : _base + __builtin_ctzll(_current);
+    }
+
+    ConnectivitySetIterator& operator++ () {
+      if (_dense != nullptr) {
+        ++_dense;
+      } else {
+        _current &= _current - 1;
+        skipEmptyWords();
+      }
+      return *this;
+    }
+
+    ConnectivitySetIterator operator++ (int) {
+      ConnectivitySetIterator copy = *this;
+      operator++ ();
+      return copy;
+    }
+
+    bool operator== (const ConnectivitySetIterator& rhs) const {
+      return _dense == rhs._dense && _word == rhs._word && _current == rhs._current;
+    }
+
+    bool operator!= (const ConnectivitySetIterator& rhs) const {
+      return !operator== (rhs);
+    }
+
+ private:
+    void skipEmptyWords() {
+      while (_current == 0 && _word != _end && ++_word != _end) {
+        _base += kBitsPerWord;
+        _current = *_word;
+      }
+    }
+
+    const PartitionID* _dense;
+    const Word* _word;
+    const Word* _end;
+    Word _current;
+    PartitionID _base;
+  };
+
   // Internal structure for connectivity sets.
-  // Each contains the size of the connectivity set as  the header
-  // and afterwards the _dense and sparse arrays and the partition pin counts.
+  // Each contains the size of the connectivity set as the header.
+  // For k <= kMaxBitsetK, the header is followed by a bitset of k bits.
+  // Otherwise it is followed by a dense array of k blocks.
   // This memory is allocated outside the structure using a memory arena.
   class ConnectivitySet {
  public:
     explicit ConnectivitySet(const PartitionID k) :
       _k(k),
       _size(0) {
-      for (PartitionID i = 0; i < _k; ++i) {
-        new(&_size + i + 1)PartitionID(std::numeric_limits<PartitionID>::max());
+      if (isBitset()) {
+        for (PartitionID i = 0; i < numWords(); ++i) {
+          new(words() + i)Word(0);
+        }
+      } else {
+        for (PartitionID i = 0; i < _k; ++i) {
+          new(&_size + i + 1)PartitionID(std::numeric_limits<PartitionID>::max());
+        }
       }
     }
 
@@ -58,61 +142,108 @@ class ConnectivitySets final {
 
     ~ConnectivitySet() = default;
 
-    const PartitionID* begin()  const {
-      return &_size + 1;
+    ConnectivitySetIterator begin() const {
+      return isBitset() ? ConnectivitySetIterator(words(), words() + numWords()) :
+             ConnectivitySetIterator(&_size + 1);
     }
 
-    const PartitionID* end() const {
-      return &_size + 1 + _size;
+    ConnectivitySetIterator end() const {
+      return isBitset() ? ConnectivitySetIterator(words() + numWords(), words() + numWords()) :
+             ConnectivitySetIterator(&_size + 1 + _size);
     }
 
     bool contains(const PartitionID value) const {
+      if (isBitset()) {
+        return words()[value / kBitsPerWord] & bit(value);
+      }
       const PartitionID* start = &_size + 1;
-      for (PartitionID i = 0; i < _k; ++i) {
-        const PartitionID k = *(start + i);
-        if (k == value) {
+      for (PartitionID i = 0; i < _size; ++i) {
+        if (*(start + i) == value) {
           return true;
-        } else if (k == std::numeric_limits<PartitionID>::max()) {
-          return false;
         }
       }
+      return false;
     }
 
     void add(const PartitionID value) {
-      *(&_size + 1 + _size) = value;
+      if (isBitset()) {
+        ASSERT(!contains(value), V(value));
+        words()[value / kBitsPerWord] |= bit(value);
+      } else {
+        *(&_size + 1 + _size) = value;
+      }
       ++_size;
     }
 
     void remove(const PartitionID value) {
+      if (isBitset()) {
+        if (contains(value)) {
+          words()[value / kBitsPerWord] &= ~bit(value);
+          --_size;
+        }
+        return;
+      }
       PartitionID* start = &_size + 1;
-      for (PartitionID i = 0; i < _k; ++i) {
-        const PartitionID k = *(start + i);
-        if (k == value) {
+      for (PartitionID i = 0; i < _size; ++i) {
+        if (*(start + i) == value) {
           *(start + i) = *(start + _size - 1);
           *(start + _size - 1) = std::numeric_limits<PartitionID>::max();
           --_size;
+          break;
         }
       }
     }
 
     void clear() {
       _size = 0;
-      for (PartitionID i = 0; i < _k; ++i) {
-        new(&_size + i + 1)PartitionID(std::numeric_limits<PartitionID>::max());
+      if (isBitset()) {
+        for (PartitionID i = 0; i < numWords(); ++i) {
+          words()[i] = 0;
+        }
+      } else {
+        for (PartitionID i = 0; i < _k; ++i) {
+          new(&_size + i + 1)PartitionID(std::numeric_limits<PartitionID>::max());
+        }
       }
     }
 
     PartitionID size() const {
+      ASSERT(!isBitset() || [&]() {
+          PartitionID size = 0;
+          for (PartitionID i = 0; i < numWords(); ++i) {
+            size += __builtin_popcountll(words()[i]);
+          }
+          return size == _size;
+        } (), V(_size));
       return _size;
     }
 
  private:
+    bool isBitset() const {
+      return _k <= kMaxBitsetK;
+    }
+
+    PartitionID numWords() const {
+      return (_k + kBitsPerWord - 1) / kBitsPerWord;
+    }
+
+    static Word bit(const PartitionID value) {
+      return static_cast<Word>(1) << (value % kBitsPerWord);
+    }
+
+    const Word* words() const {
+      return reinterpret_cast<const Word*>(&_size + 1);
+    }
+
+    Word* words() {
+      return reinterpret_cast<Word*>(&_size + 1);
+    }
+
     const PartitionID _k;
     PartitionID _size;
-    // After _size are the _dense and _sparse arrays.
+    // After _size is either the bitset or the dense array.
   };
 
-
   explicit ConnectivitySets(const HyperedgeID num_hyperedges, const PartitionID k) :
     _k(k),
     _connectivity_sets(nullptr) {
@@ -176,8 +307,11 @@ class ConnectivitySets final {
     return const_cast<ConnectivitySet*>(static_cast<const ConnectivitySets&>(*this).get(he));
   }
 
-  constexpr size_t sizeOfConnectivitySet() const {
-    return (sizeof(ConnectivitySet) + _k * sizeof(PartitionID));
+  size_t sizeOfConnectivitySet() const {
+    static_assert(sizeof(ConnectivitySet) % sizeof(Word) == 0, "Bitsets have to be aligned");
+    return _k <= kMaxBitsetK ?
+           sizeof(ConnectivitySet) + ((_k + kBitsPerWord - 1) / kBitsPerWord) * sizeof(Word) :
+           sizeof(ConnectivitySet) + _k * sizeof(PartitionID);
   }
 
   PartitionID _k;
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <queue>
 #include <unordered_map>
@@ -44,6 +45,7 @@ struct FlowEdge {
   NodeID target;
   Flow flow;
   Capacity capacity;
+  // position of the reverse edge in the edge array of the flow network
   size_t reverseEdge;
 
   void increaseFlow(const Flow delta_flow) {
@@ -52,9 +54,13 @@ struct FlowEdge {
   }
 };
 
+// The flow graph is stored in compressed sparse row format: The outgoing edges
+// of each node are stored consecutively in one edge array. While a construction
+// policy builds the flow graph, the edges are only collected and counted per node.
+// Afterwards, they are laid out in the edge array in a second pass. All buffers
+// keep their capacity between successive flow problems.
 template <class Derived = Mandatory>
 class FlowNetwork {
-  using AdjacentList = std::vector<std::vector<FlowEdge> >;
   using ConstIncidenceIterator = std::vector<FlowEdge>::const_iterator;
   using IncidenceIterator = std::vector<FlowEdge>::iterator;
   using NodeIterator = std::pair<const NodeID*, const NodeID*>;
@@ -83,7 +89,13 @@ class FlowNetwork {
     _cur_block0(0),
     _cur_block1(1),
     _contains_graph_hyperedges(hypergraph.initialNumNodes()),
-    _flow_graph(size, std::vector<FlowEdge>()),
+    _edge_list(),
+    _edges(),
+    _first_edge(size, 0),
+    _last_edge(size, 0),
+    _stored_flow(),
+    _net_flow(size, 0),
+    _unbalanced_nodes(),
     _visited(size),
     _he_visited(_hg.initialNumEdges()) { }
 
@@ -121,6 +133,7 @@ class FlowNetwork {
 
   void buildFlowGraph() {
     static_cast<Derived*>(this)->buildFlowGraphImpl();
+    layoutEdges();
   }
 
   HyperedgeWeight build(const PartitionID block_0, const PartitionID block_1) {
@@ -212,9 +225,95 @@ class FlowNetwork {
     _cur_block0 = block0;
     _cur_block1 = block1;
     _contains_graph_hyperedges.reset();
+    _edge_list.clear();
+    _edges.clear();
     _visited.reset();
   }
 
+  // ################### Warm Start ###################
+
+  // Stores the flow of the current flow problem such that it can be used as
+  // initial flow of the next flow problem (see restoreFlow).
+  void storeFlow() {
+    _stored_flow.clear();
+    for (const NodeID& node : nodes()) {
+      for (const FlowEdge& e : incidentEdges(node)) {
+        if (e.flow > 0) {
+          _stored_flow[edgeKey(e.source, e.target)] += e.flow;
+        }
+      }
+    }
+  }
+
+  void clearStoredFlow() {
+    _stored_flow.clear();
+  }
+
+  // Transfers the stored flow to all edges of the current flow problem that
+  // connect the same nodes (within the capacity of the edges). Afterwards,
+  // flow is canceled along the flow carrying edges until flow conservation
+  // holds and no source absorbs and no sink emits flow. Returns the value
+  // of the resulting flow.
+  Flow restoreFlow() {
+    if (_stored_flow.empty()) {
+      return 0;
+    }
+
+    for (const NodeID& node : nodes()) {
+      for (FlowEdge& e : incidentEdges(node)) {
+        const auto stored_flow = _stored_flow.find(edgeKey(e.source, e.target));
+        if (stored_flow != _stored_flow.end() && stored_flow->second > 0) {
+          const Flow delta = std::min(stored_flow->second, residualCapacity(e));
+          if (delta > 0) {
+            increaseFlow(e, delta);
+            stored_flow->second -= delta;
+          }
+        }
+      }
+    }
+    _stored_flow.clear();
+
+    _unbalanced_nodes.clear();
+    for (const NodeID& node : nodes()) {
+      _net_flow[node] = 0;
+      for (const FlowEdge& e : incidentEdges(node)) {
+        _net_flow[node] += e.flow;
+      }
+      if (flowToCancel(node) != 0) {
+        _unbalanced_nodes.push_back(node);
+      }
+    }
+
+    while (!_unbalanced_nodes.empty()) {
+      const NodeID u = _unbalanced_nodes.back();
+      _unbalanced_nodes.pop_back();
+      for (FlowEdge& e : incidentEdges(u)) {
+        const Flow to_cancel = flowToCancel(u);
+        if (to_cancel == 0) {
+          break;
+        }
+        // Flow leaves u over edges with positive flow and enters u over edges with negative flow
+        if ((to_cancel > 0 && e.flow > 0) || (to_cancel < 0 && e.flow < 0)) {
+          const Flow delta = to_cancel > 0 ? -std::min(to_cancel, e.flow) :
+                             std::min(-to_cancel, -e.flow);
+          increaseFlow(e, delta);
+          _net_flow[u] += delta;
+          _net_flow[e.target] -= delta;
+          if (flowToCancel(e.target) != 0) {
+            _unbalanced_nodes.push_back(e.target);
+          }
+        }
+      }
+      ASSERT(flowToCancel(u) == 0, "Flow of node " << u << " is not balanced!");
+    }
+
+    Flow flow = 0;
+    for (const NodeID& s : sources()) {
+      flow += _net_flow[s];
+    }
+    return flow;
+  }
+
   bool isTrivialFlow() const {
     const size_t num_hyperedges_s_t = _sources.size() + _sinks.size();
     return num_hyperedges_s_t == 2 * _num_hyperedges;
@@ -291,7 +390,7 @@ class FlowNetwork {
   void addNode(const NodeID node) {
     if (!containsNode(node)) {
       _nodes.add(node);
-      _flow_graph[node].clear();
+      _last_edge[node] = 0;
       _num_nodes++;
     }
   }
@@ -313,18 +412,18 @@ class FlowNetwork {
   }
 
   FlowEdge & reverseEdge(const FlowEdge& e) {
-    return _flow_graph[e.target][e.reverseEdge];
+    return _edges[e.reverseEdge];
   }
 
   std::pair<IncidenceIterator, IncidenceIterator> incidentEdges(const NodeID u) {
     ASSERT(_nodes.contains(u), "Node " << u << " is not part of the flow graph!");
-    return std::make_pair(_flow_graph[u].begin(), _flow_graph[u].end());
+    return std::make_pair(_edges.begin() + _first_edge[u], _edges.begin() + _last_edge[u]);
   }
 
 
   std::pair<ConstIncidenceIterator, ConstIncidenceIterator> incidentEdges(const NodeID u) const {
     ASSERT(_nodes.contains(u), "Node " << u << " is not part of the flow graph!");
-    return std::make_pair(_flow_graph[u].cbegin(), _flow_graph[u].cend());
+    return std::make_pair(_edges.cbegin() + _first_edge[u], _edges.cbegin() + _last_edge[u]);
   }
 
   // ################### Source And Sink ###################
@@ -418,6 +517,25 @@ class FlowNetwork {
     return cut;
   }
 
+  static uint64_t edgeKey(const NodeID u, const NodeID v) {
+    return (static_cast<uint64_t>(u) << 32) | v;
+  }
+
+  // Amount of net outflow of the node (negative for net inflow) that violates
+  // the flow constraints during restoreFlow.
+  Flow flowToCancel(const NodeID node) {
+    const bool is_source = isSource(node);
+    const bool is_sink = isSink(node);
+    if (is_source && is_sink) {
+      return 0;
+    } else if (is_source) {
+      return std::min(_net_flow[node], 0);
+    } else if (is_sink) {
+      return std::max(_net_flow[node], 0);
+    }
+    return _net_flow[node];
+  }
+
   bool isRemovableFromCut(const HyperedgeID he, const PartitionID block_0, const PartitionID block_1) {
     if (_hg.connectivity(he) > 2) {
       return false;
@@ -443,17 +561,40 @@ class FlowNetwork {
     e2.target = u;
     e2.flow = 0;
     e2.capacity = (undirected ? capacity : 0);
-    _flow_graph[u].push_back(e1);
-    _flow_graph[v].push_back(e2);
-    size_t e1_idx = _flow_graph[u].size() - 1;
-    size_t e2_idx = _flow_graph[v].size() - 1;
-    _flow_graph[u][e1_idx].reverseEdge = e2_idx;
-    _flow_graph[v][e2_idx].reverseEdge = e1_idx;
+    // An edge and its reverse edge are stored next to each other in the edge list
+    _edge_list.push_back(e1);
+    _edge_list.push_back(e2);
+    ++_last_edge[u];
+    ++_last_edge[v];
     _num_edges += (undirected ? 2 : 1);
     _num_undirected_edges += (undirected ? 1 : 0);
     _total_weight_hyperedges += (capacity < kInfty ? capacity : 0);
   }
 
+  // Moves the edges collected during construction to the edge array. The edges of
+  // a node keep the order in which they were added.
+  void layoutEdges() {
+    size_t num_edges = 0;
+    for (const NodeID& node : nodes()) {
+      const size_t degree = _last_edge[node];
+      _first_edge[node] = num_edges;
+      _last_edge[node] = num_edges;
+      num_edges += degree;
+    }
+    ASSERT(num_edges == _edge_list.size());
+
+    _edges.resize(num_edges);
+    for (size_t i = 0; i < _edge_list.size(); i += 2) {
+      const size_t e1_idx = _last_edge[_edge_list[i].source]++;
+      const size_t e2_idx = _last_edge[_edge_list[i + 1].source]++;
+      _edges[e1_idx] = _edge_list[i];
+      _edges[e2_idx] = _edge_list[i + 1];
+      _edges[e1_idx].reverseEdge = e2_idx;
+      _edges[e2_idx].reverseEdge = e1_idx;
+    }
+    _edge_list.clear();
+  }
+
   /*
    * In following with denote with:
    *   - v -> a hypernode node
@@ -538,10 +679,10 @@ class FlowNetwork {
       addEdge(v, pin, kInfty);
     } else {
       if (containsNode(u)) {
-        ASSERT(_flow_graph[u].size() == 0, "Pin of size 1 hyperedge already added in flow graph!");
+        ASSERT(_last_edge[u] == 0, "Pin of size 1 hyperedge already added in flow graph!");
         addEdge(u, pin, _hg.edgeWeight(he));
       } else if (containsNode(v)) {
-        ASSERT(_flow_graph[v].size() == 0, "Pin of size 1 hyperedge already added in flow graph!");
+        ASSERT(_last_edge[v] == 0, "Pin of size 1 hyperedge already added in flow graph!");
         addEdge(pin, v, _hg.edgeWeight(he));
       }
     }
@@ -586,7 +727,15 @@ class FlowNetwork {
   PartitionID _cur_block0;
   PartitionID _cur_block1;
   FastResetFlagArray<> _contains_graph_hyperedges;
-  AdjacentList _flow_graph;
+  std::vector<FlowEdge> _edge_list;
+  std::vector<FlowEdge> _edges;
+  std::vector<size_t> _first_edge;
+  // During construction, _last_edge[u] counts the edges of node u
+  std::vector<size_t> _last_edge;
+
+  std::unordered_map<uint64_t, Flow> _stored_flow;
+  std::vector<Flow> _net_flow;
+  std::vector<NodeID> _unbalanced_nodes;
 
   FastResetFlagArray<> _visited;
   FastResetFlagArray<> _he_visited;
@@ -38,6 +38,7 @@
 #include "kahypar/definitions.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/thread_pool.h"
 
 namespace kahypar {
 namespace ds {
@@ -511,6 +512,104 @@ class Graph {
                           node_to_contracted_node);
   }
 
+  /**
+   * Parallel version of contractClusters. The nodes are bucketed by their contracted node
+   * via counting sort and the incident cluster weights of the contracted nodes are computed
+   * in parallel. The contracted graph is identical to the one computed by contractClusters.
+   */
+  std::pair<Graph, std::vector<NodeID> > contractClusters(ThreadPool& pool) {
+    static constexpr size_t kChunkSize = 1024;
+    std::vector<NodeID> cluster_to_node(numNodes(), kInvalidNode);
+    std::vector<NodeID> node_to_contracted_node(numNodes(), kInvalidNode);
+    ClusterID new_cid = 0;
+    for (const NodeID& node : nodes()) {
+      const ClusterID cid = clusterID(node);
+      if (cluster_to_node[cid] == kInvalidNode) {
+        cluster_to_node[cid] = new_cid++;
+      }
+      node_to_contracted_node[node] = cluster_to_node[cid];
+    }
+    // Relabeling the clusters does not change the cluster sizes of existing clusters.
+    // Therefore we can avoid the expensive setClusterID calls.
+    std::vector<size_t> cluster_size(_num_nodes, 0);
+    for (const NodeID& node : nodes()) {
+      _cluster_id[node] = node_to_contracted_node[node];
+      ++cluster_size[_cluster_id[node]];
+    }
+    _cluster_size = std::move(cluster_size);
+    ASSERT(static_cast<size_t>(new_cid) == _num_communities);
+
+    std::vector<NodeID> new_hypernode_mapping(_hypernode_mapping.size(), kInvalidNode);
+    for (HypernodeID hn = 0; hn < _hypernode_mapping.size(); ++hn) {
+      if (_hypernode_mapping[hn] != kInvalidNode) {
+        new_hypernode_mapping[hn] = node_to_contracted_node[_hypernode_mapping[hn]];
+      }
+    }
+
+    std::vector<ClusterID> clusterID(new_cid);
+    std::iota(clusterID.begin(), clusterID.end(), 0);
+
+    // Counting sort of the nodes by their contracted node. Nodes of the same cluster
+    // remain sorted by ID.
+    std::vector<NodeID> cluster_begin(new_cid + 1, 0);
+    for (const NodeID& node : nodes()) {
+      ++cluster_begin[_cluster_id[node] + 1];
+    }
+    std::partial_sum(cluster_begin.begin(), cluster_begin.end(), cluster_begin.begin());
+    std::vector<NodeID> node_ids(_num_nodes);
+    {
+      std::vector<NodeID> next(cluster_begin.begin(), cluster_begin.end() - 1);
+      for (const NodeID& node : nodes()) {
+        node_ids[next[_cluster_id[node]]++] = node;
+      }
+    }
+
+    const size_t num_threads = pool.numThreads();
+    const size_t num_chunks = (static_cast<size_t>(new_cid) + kChunkSize - 1) / kChunkSize;
+    std::vector<std::vector<Edge> > chunk_edges(num_chunks);
+    std::vector<NodeID> new_adj_array(new_cid + 1, 0);
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+      pool.enqueue([&, thread]() {
+          SparseMap<ClusterID, EdgeWeight> incident_cluster_weight(new_cid);
+          for (size_t chunk = thread; chunk < num_chunks; chunk += num_threads) {
+            const ClusterID end = std::min(new_cid, static_cast<ClusterID>((chunk + 1) * kChunkSize));
+            for (ClusterID cid = chunk * kChunkSize; cid < end; ++cid) {
+              for (NodeID i = cluster_begin[cid]; i < cluster_begin[cid + 1]; ++i) {
+                for (const Edge& e : incidentEdges(node_ids[i])) {
+                  incident_cluster_weight[_cluster_id[e.target_node]] += e.weight;
+                }
+              }
+              for (const auto& element : incident_cluster_weight) {
+                Edge e;
+                e.target_node = static_cast<NodeID>(element.key);
+                e.weight = element.value;
+                chunk_edges[chunk].push_back(e);
+              }
+              new_adj_array[cid + 1] = incident_cluster_weight.size();
+              incident_cluster_weight.clear();
+            }
+          }
+        });
+    }
+    pool.waitForAll();
+
+    std::partial_sum(new_adj_array.begin(), new_adj_array.end(), new_adj_array.begin());
+    std::vector<Edge> new_edges(new_adj_array[new_cid]);
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+      pool.enqueue([&, thread]() {
+          for (size_t chunk = thread; chunk < num_chunks; chunk += num_threads) {
+            std::copy(chunk_edges[chunk].begin(), chunk_edges[chunk].end(),
+                      new_edges.begin() + new_adj_array[chunk * kChunkSize]);
+            std::vector<Edge>().swap(chunk_edges[chunk]);
+          }
+        });
+    }
+    pool.waitForAll();
+
+    return std::make_pair(Graph(new_adj_array, new_edges, new_hypernode_mapping, clusterID),
+                          node_to_contracted_node);
+  }
+
   void printGraph() {
     std::cout << "Number Nodes:" << numNodes() << std::endl;
     std::cout << "Number Edges:" << numEdges() << std::endl;
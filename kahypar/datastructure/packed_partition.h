@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+
+namespace kahypar {
+namespace ds {
+// Stores a partition of n hypernodes into k blocks using ceil(log2(k)) bits per
+// hypernode. Block IDs do not straddle word boundaries, i.e., each 64-bit word
+// holds floor(64 / bits) block IDs.
+class PackedPartition {
+  using Word = uint64_t;
+  static constexpr size_t kBitsPerWord = std::numeric_limits<Word>::digits;
+
+ public:
+  PackedPartition() :
+    _size(0),
+    _bits(0),
+    _values_per_word(0),
+    _mask(0),
+    _words() { }
+
+  PackedPartition(const size_t size, const PartitionID k) :
+    _size(size),
+    _bits(bitsPerBlockID(k)),
+    _values_per_word(kBitsPerWord / _bits),
+    _mask((Word(1) << _bits) - 1),
+    _words((size + _values_per_word - 1) / _values_per_word, 0) { }
+
+  PackedPartition(const std::vector<PartitionID>& partition, const PartitionID k) :
+    PackedPartition(partition.size(), k) {
+    for (size_t i = 0; i < partition.size(); ++i) {
+      set(i, partition[i]);
+    }
+  }
+
+  PackedPartition(const PackedPartition&) = default;
+  PackedPartition& operator= (const PackedPartition&) = default;
+
+  PackedPartition(PackedPartition&&) = default;
+  PackedPartition& operator= (PackedPartition&&) = default;
+
+  ~PackedPartition() = default;
+
+  static size_t bitsPerBlockID(const PartitionID k) {
+    ASSERT(k > 0);
+    size_t bits = 1;
+    while ((Word(1) << bits) < static_cast<Word>(k)) {
+      ++bits;
+    }
+    return bits;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  bool empty() const {
+    return _size == 0;
+  }
+
+  size_t bitsPerBlockID() const {
+    return _bits;
+  }
+
+  size_t sizeInBytes() const {
+    return _words.size() * sizeof(Word);
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE PartitionID operator[] (const size_t i) const {
+    ASSERT(i < _size);
+    return static_cast<PartitionID>((_words[i / _values_per_word] >> shift(i)) & _mask);
+  }
+
+  KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void set(const size_t i, const PartitionID part) {
+    ASSERT(i < _size);
+    ASSERT(part >= 0 && static_cast<Word>(part) <= _mask, V(part));
+    Word& word = _words[i / _values_per_word];
+    word = (word & ~(_mask << shift(i))) | (static_cast<Word>(part) << shift(i));
+  }
+
+  std::vector<PartitionID> unpack() const {
+    std::vector<PartitionID> partition(_size);
+    for (size_t i = 0; i < _size; ++i) {
+      partition[i] = (*this)[i];
+    }
+    return partition;
+  }
+
+ private:
+  size_t shift(const size_t i) const {
+    return (i % _values_per_word) * _bits;
+  }
+
+  size_t _size;
+  size_t _bits;
+  size_t _values_per_word;
+  Word _mask;
+  std::vector<Word> _words;
+};
+}  // namespace ds
+}  // namespace kahypar
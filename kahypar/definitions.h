@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <utility>
 
+#include "datastructure/concurrent_partition.h"
 #include "datastructure/hypergraph.h"
 
 // Use bucket PQ for FM refinement.
@@ -44,6 +45,8 @@ using Hypergraph = kahypar::ds::GenericHypergraph<HypernodeID,
                                                   HyperedgeID, HypernodeWeight,
                                                   HyperedgeWeight, PartitionID>;
 
+using ConcurrentPartition = kahypar::ds::ConcurrentPartition<Hypergraph>;
+
 using RatingType = double;
 using HypergraphType = Hypergraph::Type;
 using HyperedgeIndexVector = Hypergraph::HyperedgeIndexVector;
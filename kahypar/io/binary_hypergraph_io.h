@@ -0,0 +1,262 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+
+namespace kahypar {
+namespace io {
+// Binary CSR hypergraph format (native byte order):
+//
+//   BinaryHypergraphHeader
+//   uint64_t hyperedge offsets[num_hyperedges + 1]
+//   uint32_t pins[num_pins]                      (0-based hypernode IDs)
+//   int32_t  hyperedge weights[num_hyperedges]   (if type has hyperedge weights)
+//   int32_t  hypernode weights[num_hypernodes]   (if type has hypernode weights)
+//
+// All arrays are naturally aligned, which allows us to use them directly from the
+// memory-mapped file to construct the hypergraph.
+struct BinaryHypergraphHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t type;
+  uint64_t num_hypernodes;
+  uint64_t num_hyperedges;
+  uint64_t num_pins;
+};
+
+static constexpr char kBinaryHypergraphMagic[8] = { 'K', 'A', 'H', 'Y', 'P', 'A', 'R', 'B' };
+static constexpr uint32_t kBinaryHypergraphVersion = 1;
+
+static_assert(sizeof(BinaryHypergraphHeader) % sizeof(uint64_t) == 0,
+              "Offsets have to be aligned");
+static_assert(sizeof(size_t) == sizeof(uint64_t) &&
+              sizeof(HypernodeID) == sizeof(uint32_t) &&
+              sizeof(HypernodeWeight) == sizeof(int32_t) &&
+              sizeof(HyperedgeWeight) == sizeof(int32_t),
+              "Binary hypergraph format does not match the data types of the hypergraph");
+
+static inline bool hasHyperedgeWeights(const HypergraphType type) {
+  return type == HypergraphType::EdgeWeights || type == HypergraphType::EdgeAndNodeWeights;
+}
+
+static inline bool hasHypernodeWeights(const HypergraphType type) {
+  return type == HypergraphType::NodeWeights || type == HypergraphType::EdgeAndNodeWeights;
+}
+
+// Read-only view of a file. On POSIX systems the file is memory-mapped,
+// otherwise its content is read into memory.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& filename) :
+    _data(nullptr),
+    _size(0),
+    _buffer() {
+#ifndef _WIN32
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+      std::cerr << "Error: File not found: " << filename << std::endl;
+      std::exit(1);
+    }
+    struct stat file_stats;
+    if (fstat(fd, &file_stats) == -1) {
+      std::cerr << "Error: Could not determine size of " << filename << std::endl;
+      std::exit(1);
+    }
+    _size = static_cast<size_t>(file_stats.st_size);
+    if (_size > 0) {
+      void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        std::cerr << "Error: Could not map " << filename << std::endl;
+        std::exit(1);
+      }
+      // pins and offsets are scanned sequentially during hypergraph construction
+      madvise(data, _size, MADV_SEQUENTIAL);
+      _data = static_cast<const char*>(data);
+    }
+    close(fd);
+#else
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file) {
+      std::cerr << "Error: File not found: " << filename << std::endl;
+      std::exit(1);
+    }
+    _size = static_cast<size_t>(file.tellg());
+    _buffer.resize(_size / sizeof(uint64_t) + 1);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(_buffer.data()), _size);
+    _data = reinterpret_cast<const char*>(_buffer.data());
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator= (const MappedFile&) = delete;
+
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator= (MappedFile&&) = delete;
+
+  ~MappedFile() {
+#ifndef _WIN32
+    if (_data != nullptr) {
+      munmap(const_cast<char*>(_data), _size);
+    }
+#endif
+  }
+
+  const char* data() const {
+    return _data;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+ private:
+  const char* _data;
+  size_t _size;
+  // only used if memory mapping is not available (8-byte aligned)
+  std::vector<uint64_t> _buffer;
+};
+
+static inline bool isBinaryHypergraphFile(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  char magic[sizeof(kBinaryHypergraphMagic)] = { };
+  file.read(magic, sizeof(magic));
+  return file && std::memcmp(magic, kBinaryHypergraphMagic, sizeof(magic)) == 0;
+}
+
+// Constructs the hypergraph directly from the arrays of the memory-mapped file.
+static inline Hypergraph createHypergraphFromBinaryFile(const std::string& filename,
+                                                        const PartitionID num_parts) {
+  ASSERT(!filename.empty(), "No filename for hypergraph file specified");
+  const MappedFile file(filename);
+
+  BinaryHypergraphHeader header;
+  if (file.size() < sizeof(header)) {
+    std::cerr << "Error: " << filename << " is not a binary hypergraph file" << std::endl;
+    std::exit(1);
+  }
+  std::memcpy(&header, file.data(), sizeof(header));
+  if (std::memcmp(header.magic, kBinaryHypergraphMagic, sizeof(header.magic)) != 0) {
+    std::cerr << "Error: " << filename << " is not a binary hypergraph file" << std::endl;
+    std::exit(1);
+  }
+  if (header.version != kBinaryHypergraphVersion) {
+    std::cerr << "Error: Unsupported binary hypergraph version " << header.version
+              << " (expected " << kBinaryHypergraphVersion << ")" << std::endl;
+    std::exit(1);
+  }
+
+  const HypergraphType type = static_cast<HypergraphType>(header.type);
+  const bool has_hyperedge_weights = hasHyperedgeWeights(type);
+  const bool has_hypernode_weights = hasHypernodeWeights(type);
+
+  const size_t offsets_pos = sizeof(header);
+  const size_t pins_pos = offsets_pos + (header.num_hyperedges + 1) * sizeof(uint64_t);
+  const size_t hyperedge_weights_pos = pins_pos + header.num_pins * sizeof(uint32_t);
+  const size_t hypernode_weights_pos = hyperedge_weights_pos +
+                                       (has_hyperedge_weights ?
+                                        header.num_hyperedges * sizeof(int32_t) : 0);
+  const size_t expected_size = hypernode_weights_pos +
+                               (has_hypernode_weights ?
+                                header.num_hypernodes * sizeof(int32_t) : 0);
+  if (file.size() != expected_size) {
+    std::cerr << "Error: Binary hypergraph file " << filename << " is corrupted" << std::endl;
+    std::exit(1);
+  }
+
+  const size_t* index_vector = reinterpret_cast<const size_t*>(file.data() + offsets_pos);
+  const HypernodeID* edge_vector = reinterpret_cast<const HypernodeID*>(file.data() + pins_pos);
+  ASSERT(index_vector[header.num_hyperedges] == header.num_pins);
+
+  return Hypergraph(static_cast<HypernodeID>(header.num_hypernodes),
+                    static_cast<HyperedgeID>(header.num_hyperedges),
+                    index_vector, edge_vector, num_parts,
+                    has_hyperedge_weights ?
+                    reinterpret_cast<const HyperedgeWeight*>(file.data() + hyperedge_weights_pos) :
+                    nullptr,
+                    has_hypernode_weights ?
+                    reinterpret_cast<const HypernodeWeight*>(file.data() + hypernode_weights_pos) :
+                    nullptr);
+}
+
+template <typename T>
+static inline void writeBinary(std::ofstream& out_stream, const T& value) {
+  out_stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+static inline void writeBinaryHypergraphFile(const Hypergraph& hypergraph,
+                                             const std::string& filename) {
+  ASSERT(!filename.empty(), "No filename for hypergraph file specified");
+  ALWAYS_ASSERT(!hypergraph.isModified(), "Hypergraph is modified. Reindexing HNs/HEs necessary.");
+
+  BinaryHypergraphHeader header;
+  std::memcpy(header.magic, kBinaryHypergraphMagic, sizeof(header.magic));
+  header.version = kBinaryHypergraphVersion;
+  header.type = static_cast<uint32_t>(hypergraph.type());
+  header.num_hypernodes = hypergraph.initialNumNodes();
+  header.num_hyperedges = hypergraph.initialNumEdges();
+  header.num_pins = hypergraph.initialNumPins();
+
+  std::ofstream out_stream(filename.c_str(), std::ios::binary);
+  writeBinary(out_stream, header);
+
+  uint64_t offset = 0;
+  writeBinary(out_stream, offset);
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    offset += hypergraph.edgeSize(he);
+    writeBinary(out_stream, offset);
+  }
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    for (const HypernodeID& pin : hypergraph.pins(he)) {
+      writeBinary(out_stream, static_cast<uint32_t>(pin));
+    }
+  }
+  if (hasHyperedgeWeights(hypergraph.type())) {
+    for (const HyperedgeID& he : hypergraph.edges()) {
+      writeBinary(out_stream, static_cast<int32_t>(hypergraph.edgeWeight(he)));
+    }
+  }
+  if (hasHypernodeWeights(hypergraph.type())) {
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      writeBinary(out_stream, static_cast<int32_t>(hypergraph.nodeWeight(hn)));
+    }
+  }
+  out_stream.close();
+}
+}  // namespace io
+}  // namespace kahypar
@@ -20,14 +20,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "kahypar/definitions.h"
+#include "kahypar/io/binary_hypergraph_io.h"
+#include "kahypar/utils/thread_pool.h"
 
 namespace kahypar {
 namespace io {
@@ -125,16 +130,244 @@ static inline void readHypergraphFile(const std::string& filename, HypernodeID&
   }
 }
 
+namespace internal {
+struct HGRChunk {
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  // index of the first line of the chunk (relative to the first line after the header)
+  size_t first_line = 0;
+  size_t num_lines = 0;
+  size_t first_empty_hyperedge = std::numeric_limits<size_t>::max();
+  std::vector<HypernodeID> pins = { };
+  std::vector<size_t> hyperedge_sizes = { };
+  HyperedgeWeightVector hyperedge_weights = { };
+  HypernodeWeightVector hypernode_weights = { };
+};
+
+static inline bool isLineWhitespace(const char c) {
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Scans the next integer of the current line. Returns false if the line does not
+// contain any further integers.
+template <typename T>
+static inline bool scanInteger(const char*& pos, const char* line_end, T& value) {
+  while (pos != line_end && isLineWhitespace(*pos)) {
+    ++pos;
+  }
+  if (pos == line_end) {
+    return false;
+  }
+  bool negative = false;
+  if (*pos == '-' || *pos == '+') {
+    negative = *pos == '-';
+    ++pos;
+  }
+  if (pos == line_end || *pos < '0' || *pos > '9') {
+    return false;
+  }
+  int64_t result = 0;
+  while (pos != line_end && *pos >= '0' && *pos <= '9') {
+    result = 10 * result + (*pos - '0');
+    ++pos;
+  }
+  value = static_cast<T>(negative ? -result : result);
+  return true;
+}
+
+static inline const char* lineEnd(const char* pos, const char* end) {
+  const void* newline = std::memchr(pos, '\n', end - pos);
+  return newline == nullptr ? end : static_cast<const char*>(newline);
+}
+
+static inline void parseHGRChunk(HGRChunk& chunk, const HyperedgeID num_hyperedges,
+                                 const HypernodeID num_hypernodes,
+                                 const bool has_hyperedge_weights,
+                                 const bool has_hypernode_weights) {
+  size_t line = chunk.first_line;
+  for (const char* pos = chunk.begin; pos < chunk.end; ++line) {
+    const char* line_end = lineEnd(pos, chunk.end);
+    if (line < num_hyperedges) {
+      if (pos == line_end && chunk.first_empty_hyperedge > line) {
+        chunk.first_empty_hyperedge = line;
+      }
+      if (has_hyperedge_weights) {
+        HyperedgeWeight edge_weight = 0;
+        scanInteger(pos, line_end, edge_weight);
+        chunk.hyperedge_weights.push_back(edge_weight);
+      }
+      size_t size = 0;
+      HypernodeID pin = 0;
+      while (scanInteger(pos, line_end, pin)) {
+        // Hypernode IDs start from 0
+        --pin;
+        ASSERT(pin < num_hypernodes, "Invalid hypernode ID");
+        chunk.pins.push_back(pin);
+        ++size;
+      }
+      chunk.hyperedge_sizes.push_back(size);
+    } else if (has_hypernode_weights && line < num_hyperedges + num_hypernodes) {
+      HypernodeWeight node_weight = 0;
+      scanInteger(pos, line_end, node_weight);
+      chunk.hypernode_weights.push_back(node_weight);
+    }
+    pos = line_end + 1;
+  }
+}
+}  // namespace internal
+
+// Parses the same hMetis format as readHypergraphFile. The file is memory-mapped
+// and split into chunks at line boundaries that are parsed independently by
+// num_threads threads. Prefix sums over the number of lines and pins of all
+// chunks are then used to assemble the final arrays.
+static inline void parseHypergraphFile(const std::string& filename, HypernodeID& num_hypernodes,
+                                       HyperedgeID& num_hyperedges,
+                                       HyperedgeIndexVector& index_vector,
+                                       HyperedgeVector& edge_vector,
+                                       HyperedgeWeightVector* hyperedge_weights = nullptr,
+                                       HypernodeWeightVector* hypernode_weights = nullptr,
+                                       const size_t num_threads = 1,
+                                       const size_t min_chunk_size = 1 << 20) {
+  ASSERT(!filename.empty(), "No filename for hypergraph file specified");
+  const MappedFile file(filename);
+  const char* pos = file.data();
+  const char* end = file.data() + file.size();
+
+  // skip any comments
+  const char* line_end = internal::lineEnd(pos, end);
+  while (pos != end && *pos == '%') {
+    pos = std::min(line_end + 1, end);
+    line_end = internal::lineEnd(pos, end);
+  }
+  int type = 0;
+  internal::scanInteger(pos, line_end, num_hyperedges);
+  internal::scanInteger(pos, line_end, num_hypernodes);
+  internal::scanInteger(pos, line_end, type);
+  const HypergraphType hypergraph_type = static_cast<HypergraphType>(type);
+  ASSERT(hypergraph_type == HypergraphType::Unweighted ||
+         hypergraph_type == HypergraphType::EdgeWeights ||
+         hypergraph_type == HypergraphType::NodeWeights ||
+         hypergraph_type == HypergraphType::EdgeAndNodeWeights,
+         "Hypergraph in file has wrong type");
+  const bool has_hyperedge_weights = hasHyperedgeWeights(hypergraph_type);
+  const bool has_hypernode_weights = hasHypernodeWeights(hypergraph_type);
+  const char* body = std::min(line_end + 1, end);
+
+  // split the remaining file into chunks that end at line boundaries
+  const size_t body_size = end - body;
+  const size_t num_chunks = std::max(static_cast<size_t>(1),
+                                     std::min(4 * num_threads, body_size / min_chunk_size));
+  std::vector<internal::HGRChunk> chunks;
+  const char* chunk_begin = body;
+  for (size_t i = 1; i <= num_chunks && chunk_begin < end; ++i) {
+    const char* chunk_end = i == num_chunks ? end : body + i * (body_size / num_chunks);
+    if (chunk_end < chunk_begin) {
+      continue;
+    }
+    chunk_end = std::min(internal::lineEnd(chunk_end, end) + 1, end);
+    chunks.emplace_back();
+    chunks.back().begin = chunk_begin;
+    chunks.back().end = chunk_end;
+    chunk_begin = chunk_end;
+  }
+
+  {
+    ThreadPool pool(std::min(num_threads, chunks.size()));
+    for (internal::HGRChunk& chunk : chunks) {
+      pool.enqueue([&chunk]() {
+          chunk.num_lines = std::count(chunk.begin, chunk.end, '\n') +
+                            (*(chunk.end - 1) != '\n' ? 1 : 0);
+        });
+    }
+    pool.waitForAll();
+    for (size_t i = 1; i < chunks.size(); ++i) {
+      chunks[i].first_line = chunks[i - 1].first_line + chunks[i - 1].num_lines;
+    }
+
+    for (internal::HGRChunk& chunk : chunks) {
+      pool.enqueue([&chunk, num_hyperedges, num_hypernodes,
+                    has_hyperedge_weights, has_hypernode_weights]() {
+          internal::parseHGRChunk(chunk, num_hyperedges, num_hypernodes,
+                                  has_hyperedge_weights, has_hypernode_weights);
+        });
+    }
+    pool.waitForAll();
+
+    // missing hyperedge lines are reported as empty hyperedges
+    size_t first_empty_hyperedge = 0;
+    for (const internal::HGRChunk& chunk : chunks) {
+      first_empty_hyperedge += chunk.hyperedge_sizes.size();
+    }
+    for (const internal::HGRChunk& chunk : chunks) {
+      first_empty_hyperedge = std::min(first_empty_hyperedge, chunk.first_empty_hyperedge);
+    }
+    if (first_empty_hyperedge < num_hyperedges) {
+      std::cerr << "Error: Hyperedge " << first_empty_hyperedge << " is empty" << std::endl;
+      exit(1);
+    }
+
+    // assemble final arrays
+    std::vector<size_t> first_hyperedge(chunks.size() + 1, 0);
+    std::vector<size_t> first_pin(chunks.size() + 1, 0);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      first_hyperedge[i + 1] = first_hyperedge[i] + chunks[i].hyperedge_sizes.size();
+      first_pin[i + 1] = first_pin[i] + chunks[i].pins.size();
+    }
+    index_vector.assign(static_cast<size_t>(num_hyperedges) +  /*sentinel*/ 1, 0);
+    edge_vector.resize(first_pin.back());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      pool.enqueue([&chunks, &index_vector, &edge_vector, &first_hyperedge, &first_pin, i]() {
+          const internal::HGRChunk& chunk = chunks[i];
+          std::copy(chunk.pins.begin(), chunk.pins.end(), edge_vector.begin() + first_pin[i]);
+          size_t offset = first_pin[i];
+          for (size_t j = 0; j < chunk.hyperedge_sizes.size(); ++j) {
+            offset += chunk.hyperedge_sizes[j];
+            index_vector[first_hyperedge[i] + j + 1] = offset;
+          }
+        });
+    }
+    pool.waitForAll();
+  }
+
+  if (has_hyperedge_weights) {
+    if (hyperedge_weights == nullptr) {
+      LOG << "****** ignoring hyperedge weights ******";
+    } else {
+      for (const internal::HGRChunk& chunk : chunks) {
+        hyperedge_weights->insert(hyperedge_weights->end(), chunk.hyperedge_weights.begin(),
+                                  chunk.hyperedge_weights.end());
+      }
+    }
+  }
+  if (has_hypernode_weights) {
+    if (hypernode_weights == nullptr) {
+      LOG << " ****** ignoring hypernode weights ******";
+    } else {
+      for (const internal::HGRChunk& chunk : chunks) {
+        hypernode_weights->insert(hypernode_weights->end(), chunk.hypernode_weights.begin(),
+                                  chunk.hypernode_weights.end());
+      }
+      ASSERT(hypernode_weights->size() == num_hypernodes);
+    }
+  }
+}
+
+// Hypergraphs stored in the binary format (see binary_hypergraph_io.h) are
+// detected automatically and loaded without parsing.
 static inline Hypergraph createHypergraphFromFile(const std::string& filename,
-                                                  const PartitionID num_parts) {
+                                                  const PartitionID num_parts,
+                                                  const size_t num_threads = 1) {
+  if (isBinaryHypergraphFile(filename)) {
+    return createHypergraphFromBinaryFile(filename, num_parts);
+  }
   HypernodeID num_hypernodes;
   HyperedgeID num_hyperedges;
   HyperedgeIndexVector index_vector;
   HyperedgeVector edge_vector;
   HypernodeWeightVector hypernode_weights;
   HyperedgeWeightVector hyperedge_weights;
-  readHypergraphFile(filename, num_hypernodes, num_hyperedges,
-                     index_vector, edge_vector, &hyperedge_weights, &hypernode_weights);
+  parseHypergraphFile(filename, num_hypernodes, num_hyperedges, index_vector, edge_vector,
+                      &hyperedge_weights, &hypernode_weights, num_threads);
   return Hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector,
                     num_parts, &hyperedge_weights, &hypernode_weights);
 }
@@ -144,10 +144,13 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
         << " IP_local_search_algorithm="
         << context.initial_partitioning.local_search.algorithm
         << " IP_local_search_iterations_per_level="
-        << context.initial_partitioning.local_search.iterations_per_level;
+        << context.initial_partitioning.local_search.iterations_per_level
+        << " IP_local_search_uncontraction_batch_size="
+        << context.initial_partitioning.local_search.uncontraction_batch_size;
     if (context.initial_partitioning.local_search.algorithm == RefinementAlgorithm::twoway_fm ||
         context.initial_partitioning.local_search.algorithm == RefinementAlgorithm::kway_fm ||
-        context.initial_partitioning.local_search.algorithm == RefinementAlgorithm::kway_fm_km1) {
+        context.initial_partitioning.local_search.algorithm == RefinementAlgorithm::kway_fm_km1 ||
+        context.initial_partitioning.local_search.algorithm == RefinementAlgorithm::kway_fm_parallel_km1) {
       oss << " IP_local_search_fm_stopping_rule="
           << context.initial_partitioning.local_search.fm.stopping_rule
           << " IP_local_search_fm_max_number_of_fruitless_moves="
@@ -166,6 +169,8 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
           << context.initial_partitioning.local_search.flow.execution_policy
           << " IP_flow_use_most_balanced_minimum_cut="
           << std::boolalpha << context.initial_partitioning.local_search.flow.use_most_balanced_minimum_cut
+          << " IP_flow_most_balanced_minimum_cut_sweeps="
+          << context.initial_partitioning.local_search.flow.most_balanced_minimum_cut_sweeps
           << " IP_flow_max_alpha="
           << context.initial_partitioning.local_search.flow.alpha;
       if (context.initial_partitioning.local_search.flow.execution_policy == FlowExecutionMode::constant) {
@@ -177,14 +182,19 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
           << " IP_flow_ignore_small_he_cut="
           << std::boolalpha << context.initial_partitioning.local_search.flow.ignore_small_hyperedge_cut
           << " IP_flow_use_improvement_history="
-          << std::boolalpha << context.initial_partitioning.local_search.flow.use_improvement_history;
+          << std::boolalpha << context.initial_partitioning.local_search.flow.use_improvement_history
+          << " IP_flow_use_warm_start="
+          << std::boolalpha << context.initial_partitioning.local_search.flow.use_warm_start;
     }
 
     oss << " local_search_algorithm=" << context.local_search.algorithm
-        << " local_search_iterations_per_level=" << context.local_search.iterations_per_level;
+        << " local_search_iterations_per_level=" << context.local_search.iterations_per_level
+        << " local_search_uncontraction_batch_size="
+        << context.local_search.uncontraction_batch_size;
     if (context.local_search.algorithm == RefinementAlgorithm::twoway_fm ||
         context.local_search.algorithm == RefinementAlgorithm::kway_fm ||
-        context.local_search.algorithm == RefinementAlgorithm::kway_fm_km1) {
+        context.local_search.algorithm == RefinementAlgorithm::kway_fm_km1 ||
+        context.local_search.algorithm == RefinementAlgorithm::kway_fm_parallel_km1) {
       oss << " local_search_fm_stopping_rule=" << context.local_search.fm.stopping_rule
           << " local_search_fm_max_number_of_fruitless_moves="
           << context.local_search.fm.max_number_of_fruitless_moves
@@ -202,6 +212,8 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
           << context.local_search.flow.execution_policy
           << " flow_use_most_balanced_minimum_cut="
           << std::boolalpha << context.local_search.flow.use_most_balanced_minimum_cut
+          << " flow_most_balanced_minimum_cut_sweeps="
+          << context.local_search.flow.most_balanced_minimum_cut_sweeps
           << " flow_max_alpha="
           << context.local_search.flow.alpha;
       if (context.local_search.flow.execution_policy == FlowExecutionMode::constant) {
@@ -213,7 +225,9 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
           << " flow_ignore_small_he_cut="
           << std::boolalpha << context.local_search.flow.ignore_small_hyperedge_cut
           << " flow_use_improvement_history="
-          << std::boolalpha << context.local_search.flow.use_improvement_history;
+          << std::boolalpha << context.local_search.flow.use_improvement_history
+          << " flow_use_warm_start="
+          << std::boolalpha << context.local_search.flow.use_warm_start;
     }
     oss << " iteration=" << iteration;
     for (PartitionID i = 0; i != hypergraph.k(); ++i) {
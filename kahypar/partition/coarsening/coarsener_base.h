@@ -70,6 +70,10 @@ class CoarsenerBase {
 
  protected:
   void performContraction(const HypernodeID rep_node, const HypernodeID contracted_node) {
+    if (_history.empty()) {
+      // The edge hashes are recomputed before each coarsening phase.
+      _hypergraph_pruner.initializeFingerprintIndex(_hg);
+    }
     _history.emplace_back(_hg.contract(rep_node, contracted_node));
     if (_hg.nodeWeight(rep_node) > _max_hn_weights.back().max_weight) {
       _max_hn_weights.emplace_back(CurrentMaxNodeWeight { _hg.currentNumNodes(),
@@ -89,6 +93,10 @@ class CoarsenerBase {
     const HyperedgeID removed_parallel_hes =
       _hypergraph_pruner.removeParallelHyperedges(_hg, _history.back());
     _context.stats.add(StatTag::Coarsening, "numRemovedParalellHEs", removed_parallel_hes);
+    _context.stats.add(StatTag::Coarsening, "numParallelHEProbes",
+                       _hypergraph_pruner.numProbes());
+    _context.stats.add(StatTag::Coarsening, "numSavedParallelHEProbes",
+                       _hypergraph_pruner.numSavedProbes());
   }
 
   void restoreParallelHyperedges() {
@@ -100,21 +108,17 @@ class CoarsenerBase {
   }
 
   void initializeRefiner(IRefiner& refiner) {
-#ifdef USE_BUCKET_QUEUE
-    HyperedgeID max_degree = 0;
+    // The maximum weighted degree bounds the gain of any move on the current level
+    // and is used to decide whether the refiner can use bucket priority queues.
+    HyperedgeWeight max_weighted_degree = 0;
     for (const HypernodeID& hn : _hg.nodes()) {
-      max_degree = std::max(max_degree, _hg.nodeDegree(hn));
-    }
-    HyperedgeWeight max_he_weight = 0;
-    for (const HyperedgeID& he : _hg.edges()) {
-      max_he_weight = std::max(max_he_weight, _hg.edgeWeight(he));
+      HyperedgeWeight weighted_degree = 0;
+      for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+        weighted_degree += _hg.edgeWeight(he);
+      }
+      max_weighted_degree = std::max(max_weighted_degree, weighted_degree);
     }
-    LOG << V(max_degree);
-    LOG << V(max_he_weight);
-    refiner.initialize(static_cast<HyperedgeWeight>(max_degree * max_he_weight));
-#else
-    refiner.initialize(0);
-#endif
+    refiner.initialize(max_weighted_degree);
   }
 
   void performLocalSearch(IRefiner& refiner, std::vector<HypernodeID>& refinement_nodes,
@@ -125,8 +129,8 @@ class CoarsenerBase {
     bool improvement_found = performLocalSearchIteration(refiner, refinement_nodes, changes,
                                                          current_metrics);
     UncontractionGainChanges no_changes;
-    no_changes.representative.push_back(0);
-    no_changes.contraction_partner.push_back(0);
+    no_changes.representative.resize(changes.representative.size(), 0);
+    no_changes.contraction_partner.resize(changes.contraction_partner.size(), 0);
 
     int iteration = 1;
     while ((iteration < _context.local_search.iterations_per_level) && improvement_found) {
@@ -53,7 +53,14 @@ class HypergraphPruner {
     _removed_single_node_hyperedges(),
     _removed_parallel_hyperedges(),
     _fingerprints(),
-    _contained_hypernodes(max_num_nodes) { }
+    _contained_hypernodes(max_num_nodes),
+    _first_in_bucket(),
+    _next_in_chain(),
+    _prev_in_chain(),
+    _has_initial_collision(),
+    _index_initialized(false),
+    _num_probes(0),
+    _num_saved_probes(0) { }
 
   HypergraphPruner(const HypergraphPruner&) = delete;
   HypergraphPruner& operator= (const HypergraphPruner&) = delete;
@@ -108,6 +115,9 @@ class HypergraphPruner {
         removed_he_weight += hypergraph.edgeWeight(*he_it);
         ++memento.one_pin_hes_size;
         DBG << "removing single-node HE" << *he_it;
+        if (_index_initialized) {
+          removeFromFingerprintIndex(*he_it, hypergraph.edgeHash(*he_it));
+        }
         hypergraph.removeEdge(*he_it);
         --he_it;
         --end_it;
@@ -116,25 +126,25 @@ class HypergraphPruner {
     return removed_he_weight;
   }
 
-  // Parallel hyperedge detection is done via fingerprinting. For each hyperedge incident
-  // to the representative, we first create a fingerprint ({he,hash,|he|}). The fingerprints
-  // are then sorted according to the hash value, which brings those hyperedges together that
-  // are likely to be parallel (due to same hash). Afterwards we perform one pass over the vector
-  // of fingerprints and check whether two neighboring hashes are equal. In this case we have
-  // to check the pins of both HEs in order to determine whether they are really equal or not.
-  // This check is only performed, if the sizes of both HEs match - otherwise they can't be
-  // parallel. In case we detect a parallel HE, it is removed from the graph and we proceed by
-  // checking if there are more fingerprints with the same hash value.
+  // Parallel hyperedge detection is done via fingerprinting. All enabled hyperedges are
+  // kept in an index that chains hyperedges whose hash values ({he,hash}) fall into the
+  // same bucket. Since the
+  // hashes are updated incrementally, only the fingerprints of hyperedges that contained
+  // the contracted hypernode change. These hyperedges are re-inserted into the index and
+  // are the only ones that can have become parallel to another hyperedge. Thus, instead of
+  // sorting the fingerprints of all hyperedges incident to the representative, we only probe
+  // the chains of the changed hyperedges. Pins are only compared if the sizes of both HEs
+  // match - otherwise they can't be parallel. In case we detect a parallel HE, it is removed
+  // from the graph and we proceed with the remaining hyperedges of the chain.
   HyperedgeID removeParallelHyperedges(Hypergraph& hypergraph,
                                        CoarseningMemento& memento) {
     memento.parallel_hes_begin = _removed_parallel_hyperedges.size();
+    if (!_index_initialized) {
+      initializeFingerprintIndex(hypergraph);
+    }
 
     createFingerprints(hypergraph, memento.contraction_memento.u, memento.contraction_memento.v);
-    std::sort(_fingerprints.begin(), _fingerprints.end(),
-              [](const Fingerprint& a, const Fingerprint& b) { return a.hash < b.hash; });
 
-    // debug_state = std::find_if(_fingerprints.begin(), _fingerprints.end(),
-    // [](const Fingerprint& a) {return a.id == 20686;}) != _fingerprints.end();
     DBG <<[&]() {
       for (const auto& fp : _fingerprints) {
         LOG << "{" << fp.id << "," << fp.hash << "}";
@@ -142,43 +152,35 @@ class HypergraphPruner {
       return std::string("");
       } ();
 
-    size_t i = 0;
     HyperedgeWeight removed_parallel_hes = 0;
-    bool filled_probe_bitset = false;
-    while (i < _fingerprints.size()) {
-      size_t j = i + 1;
-      DBG << "i=" << i << ", j=" << j;
-      if (_fingerprints[i].id != kInvalidID) {
-        ASSERT(hypergraph.edgeIsEnabled(_fingerprints[i].id), V(_fingerprints[i].id));
-        while (j < _fingerprints.size() && _fingerprints[i].hash == _fingerprints[j].hash) {
-          // If we are here, then we have a hash collision for _fingerprints[i].id and
-          // _fingerprints[j].id.
-          DBG << _fingerprints[i].hash << "==" << _fingerprints[j].hash;
-          DBG << "Size:" << hypergraph.edgeSize(_fingerprints[i].id) << "=="
-              << hypergraph.edgeSize(_fingerprints[j].id);
-          if (_fingerprints[j].id != kInvalidID &&
-              hypergraph.edgeSize(_fingerprints[i].id) == hypergraph.edgeSize(_fingerprints[j].id)) {
-            ASSERT(hypergraph.edgeIsEnabled(_fingerprints[j].id), V(_fingerprints[j].id));
-            if (!filled_probe_bitset) {
-              fillProbeBitset(hypergraph, _fingerprints[i].id);
-              filled_probe_bitset = true;
-            }
-            if (isParallelHyperedge(hypergraph, _fingerprints[j].id)) {
-              removed_parallel_hes += 1;
-              removeParallelHyperedge(hypergraph, _fingerprints[i].id, _fingerprints[j].id);
-              _fingerprints[j].id = kInvalidID;
-              ++memento.parallel_hes_size;
-            }
+    for (const Fingerprint& fp : _fingerprints) {
+      if (!hypergraph.edgeIsEnabled(fp.id)) {
+        // already removed as parallel hyperedge of a previous fingerprint
+        continue;
+      }
+      bool filled_probe_bitset = false;
+      HyperedgeID he = _first_in_bucket[bucket(fp.hash)];
+      while (he != kInvalidID) {
+        const HyperedgeID next = _next_in_chain[he];
+        ASSERT(hypergraph.edgeIsEnabled(he), V(he));
+        if (he != fp.id && hypergraph.edgeHash(he) == fp.hash &&
+            hypergraph.edgeSize(fp.id) == hypergraph.edgeSize(he)) {
+          // If we are here, then we have a hash collision for fp.id and he.
+          if (!filled_probe_bitset) {
+            fillProbeBitset(hypergraph, fp.id);
+            filled_probe_bitset = true;
+          }
+          if (isParallelHyperedge(hypergraph, he)) {
+            removed_parallel_hes += 1;
+            removeFromFingerprintIndex(he, fp.hash);
+            removeParallelHyperedge(hypergraph, fp.id, he);
+            ++memento.parallel_hes_size;
           }
-          ++j;
         }
+        he = next;
       }
-      // We need pairwise comparisons for all HEs with same hash.
-      filled_probe_bitset = false;
-      ++i;
     }
 
-
     ASSERT([&]() {
         for (auto edge_it = hypergraph.incidentEdges(memento.contraction_memento.u).first;
              edge_it != hypergraph.incidentEdges(memento.contraction_memento.u).second; ++edge_it) {
@@ -244,16 +246,28 @@ class HypergraphPruner {
     _removed_parallel_hyperedges.emplace_back(ParallelHE { representative, to_remove });
   }
 
+  // Updates the hashes of all hyperedges that were affected by the contraction and
+  // collects their fingerprints. Hyperedges that were not affected by the contraction
+  // only have to be probed if they already collided with an equal-sized hyperedge
+  // when the index was built (i.e., if the input contains parallel hyperedges).
   void createFingerprints(Hypergraph& hypergraph, const HypernodeID u, const HypernodeID v) {
     _fingerprints.clear();
+    HyperedgeID num_incident_edges = 0;
     for (const HyperedgeID& he : hypergraph.incidentEdges(u)) {
-      if (hypergraph.edgeContractionType(he) == Hypergraph::ContractionType::Case2) {
-        hypergraph.edgeHash(he) -= math::hash(v);
-        hypergraph.edgeHash(he) += math::hash(u);
-      } else if (hypergraph.edgeContractionType(he) == Hypergraph::ContractionType::Case1) {
+      ++num_incident_edges;
+      const Hypergraph::ContractionType type = hypergraph.edgeContractionType(he);
+      if (type == Hypergraph::ContractionType::Case1 ||
+          type == Hypergraph::ContractionType::Case2) {
+        removeFromFingerprintIndex(he, hypergraph.edgeHash(he));
         hypergraph.edgeHash(he) -= math::hash(v);
+        if (type == Hypergraph::ContractionType::Case2) {
+          hypergraph.edgeHash(he) += math::hash(u);
+        }
+        insertIntoFingerprintIndex(he, hypergraph.edgeHash(he));
+        hypergraph.resetEdgeContractionType(he);
+      } else if (!_has_initial_collision[he]) {
+        continue;
       }
-      hypergraph.resetEdgeContractionType(he);
       ASSERT([&]() {
           size_t correct_hash = Hypergraph::kEdgeHashSeed;
           for (const HypernodeID& pin : hypergraph.pins(he)) {
@@ -270,6 +284,42 @@ class HypergraphPruner {
           << "," << hypergraph.edgeSize(he) << "}";
       _fingerprints.emplace_back(Fingerprint { he, hypergraph.edgeHash(he) });
     }
+    _num_probes = _fingerprints.size();
+    _num_saved_probes = num_incident_edges - _fingerprints.size();
+  }
+
+  // Builds the fingerprint index for all enabled hyperedges. Has to be called whenever the
+  // edge hashes were recomputed, i.e., before each coarsening phase.
+  void initializeFingerprintIndex(Hypergraph& hypergraph) {
+    _first_in_bucket.assign(math::nextPrime(hypergraph.initialNumEdges()),
+                            static_cast<HyperedgeID>(kInvalidID));
+    _next_in_chain.assign(hypergraph.initialNumEdges(), static_cast<HyperedgeID>(kInvalidID));
+    _prev_in_chain.assign(hypergraph.initialNumEdges(), static_cast<HyperedgeID>(kInvalidID));
+    _has_initial_collision.assign(hypergraph.initialNumEdges(), false);
+    for (const HyperedgeID& he : hypergraph.edges()) {
+      const size_t hash = hypergraph.edgeHash(he);
+      for (HyperedgeID other = _first_in_bucket[bucket(hash)]; other != kInvalidID;
+           other = _next_in_chain[other]) {
+        if (hypergraph.edgeHash(other) == hash &&
+            hypergraph.edgeSize(other) == hypergraph.edgeSize(he)) {
+          _has_initial_collision[other] = true;
+          _has_initial_collision[he] = true;
+        }
+      }
+      insertIntoFingerprintIndex(he, hash);
+    }
+    _index_initialized = true;
+  }
+
+  // Number of fingerprints probed during the last call of removeParallelHyperedges.
+  HyperedgeID numProbes() const {
+    return _num_probes;
+  }
+
+  // Number of incident hyperedges of the representative that did not have to be probed
+  // during the last call of removeParallelHyperedges.
+  HyperedgeID numSavedProbes() const {
+    return _num_saved_probes;
   }
 
   const std::vector<ParallelHE> & removedParallelHyperedges() const {
@@ -281,9 +331,45 @@ class HypergraphPruner {
   }
 
  private:
+  size_t bucket(const size_t hash) const {
+    return hash % _first_in_bucket.size();
+  }
+
+  void insertIntoFingerprintIndex(const HyperedgeID he, const size_t hash) {
+    HyperedgeID& first = _first_in_bucket[bucket(hash)];
+    if (first != kInvalidID) {
+      _prev_in_chain[first] = he;
+    }
+    _next_in_chain[he] = first;
+    first = he;
+  }
+
+  void removeFromFingerprintIndex(const HyperedgeID he, const size_t hash) {
+    const HyperedgeID prev = _prev_in_chain[he];
+    const HyperedgeID next = _next_in_chain[he];
+    if (next != kInvalidID) {
+      _prev_in_chain[next] = prev;
+    }
+    if (prev != kInvalidID) {
+      _next_in_chain[prev] = next;
+    } else {
+      _first_in_bucket[bucket(hash)] = next;
+    }
+    _prev_in_chain[he] = kInvalidID;
+    _next_in_chain[he] = kInvalidID;
+  }
+
   std::vector<HyperedgeID> _removed_single_node_hyperedges;
   std::vector<ParallelHE> _removed_parallel_hyperedges;
   std::vector<Fingerprint> _fingerprints;
   ds::FastResetFlagArray<uint64_t> _contained_hypernodes;
+  // first hyperedge of the chain of hyperedges whose hashes fall into each bucket
+  std::vector<HyperedgeID> _first_in_bucket;
+  std::vector<HyperedgeID> _next_in_chain;
+  std::vector<HyperedgeID> _prev_in_chain;
+  std::vector<bool> _has_initial_collision;
+  bool _index_initialized;
+  HyperedgeID _num_probes;
+  HyperedgeID _num_saved_probes;
 };
 }  // namespace kahypar
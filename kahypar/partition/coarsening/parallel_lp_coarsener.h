@@ -0,0 +1,249 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "kahypar/datastructure/fast_reset_flag_array.h"
+#include "kahypar/datastructure/sparse_map.h"
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+#include "kahypar/partition/coarsening/i_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_community_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_partition_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "kahypar/partition/coarsening/vertex_pair_coarsener_base.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/thread_pool.h"
+
+namespace kahypar {
+// Multilevel coarsener that computes a clustering of the current hypergraph
+// via size-constrained label propagation and then contracts all clusters of
+// that level. Each cluster is a star around its representative: a hypernode
+// can only join a cluster whose representative has not joined another cluster.
+//
+// The ratings of one round are computed in parallel on a read-only view of the
+// hypergraph (synchronous label propagation), the resulting moves are applied
+// sequentially to enforce the weight constraint. Since each chunk of hypernodes
+// uses its own derived seed, the clustering does not depend on the number of
+// threads. The clusters are contracted via the usual contraction operation,
+// i.e., uncoarsening remains n-level.
+template <class ScorePolicy = HeavyEdgeScore,
+          class HeavyNodePenaltyPolicy = NoWeightPenalty,
+          class CommunityPolicy = UseCommunityStructure,
+          class RatingPartitionPolicy = NormalPartitionPolicy,
+          class AcceptancePolicy = BestRatingPreferringUnmatched<>,
+          class FixedVertexPolicy = AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+          typename RatingType = RatingType>
+class ParallelLPCoarsener final : public ICoarsener,
+                                  private VertexPairCoarsenerBase<>{
+ private:
+  static constexpr bool debug = false;
+
+  static constexpr HypernodeID kInvalidTarget = std::numeric_limits<HypernodeID>::max();
+  static constexpr size_t kChunkSize = 1024;
+  static constexpr size_t kNumLabelPropagationRounds = 3;
+
+  using Base = VertexPairCoarsenerBase;
+  using RatingMap = ds::SparseMap<HypernodeID, RatingType>;
+
+ public:
+  ParallelLPCoarsener(Hypergraph& hypergraph, const Context& context,
+                      const HypernodeWeight weight_of_heaviest_node) :
+    Base(hypergraph, context, weight_of_heaviest_node),
+    _cluster(_hg.initialNumNodes(), 0),
+    _cluster_weight(_hg.initialNumNodes(), 0),
+    _target(_hg.initialNumNodes(), 0),
+    _in_cluster(_hg.initialNumNodes()),
+    _ratings() { }
+
+  ~ParallelLPCoarsener() override = default;
+
+  ParallelLPCoarsener(const ParallelLPCoarsener&) = delete;
+  ParallelLPCoarsener& operator= (const ParallelLPCoarsener&) = delete;
+
+  ParallelLPCoarsener(ParallelLPCoarsener&&) = delete;
+  ParallelLPCoarsener& operator= (ParallelLPCoarsener&&) = delete;
+
+ private:
+  void coarsenImpl(const HypernodeID limit) override final {
+    const size_t num_threads = std::max(_context.partition.num_threads,
+                                        static_cast<size_t>(1));
+    // Even with a single thread, the ratings are computed by a worker of the pool
+    // so that the derived seeds do not interfere with the random generator of
+    // the calling thread.
+    ThreadPool pool(num_threads);
+    while (_ratings.size() < num_threads) {
+      _ratings.emplace_back(std::make_unique<RatingMap>(_hg.initialNumNodes()));
+    }
+
+    int pass_nr = 0;
+    std::vector<HypernodeID> current_hns;
+    while (_hg.currentNumNodes() > limit) {
+      DBG << V(pass_nr);
+      DBG << V(_hg.currentNumNodes());
+      DBG << V(_hg.currentNumEdges());
+      current_hns.clear();
+      for (const HypernodeID& hn : _hg.nodes()) {
+        current_hns.push_back(hn);
+        _cluster[hn] = hn;
+        _cluster_weight[hn] = _hg.nodeWeight(hn);
+      }
+      Randomize::instance().shuffleVector(current_hns, current_hns.size());
+      _in_cluster.reset();
+
+      HypernodeID num_hns_after_pass = _hg.currentNumNodes();
+      for (size_t round = 0; round < kNumLabelPropagationRounds &&
+           num_hns_after_pass > limit; ++round) {
+        computeTargets(current_hns, pool);
+        const HypernodeID num_hns_before_round = num_hns_after_pass;
+        num_hns_after_pass = applyTargets(current_hns, limit, num_hns_after_pass);
+        if (num_hns_after_pass == num_hns_before_round) {
+          break;
+        }
+      }
+
+      if (num_hns_after_pass == _hg.currentNumNodes()) {
+        break;
+      }
+
+      for (const HypernodeID& hn : current_hns) {
+        if (_cluster[hn] != hn) {
+          performContraction(_cluster[hn], hn);
+        }
+      }
+      ASSERT(_hg.currentNumNodes() == num_hns_after_pass, V(_hg.currentNumNodes()));
+      ++pass_nr;
+    }
+    _context.stats.add(StatTag::Coarsening, "HnsAfterCoarsening", _hg.currentNumNodes());
+  }
+
+  bool uncoarsenImpl(IRefiner& refiner) override final {
+    return doUncoarsen(refiner);
+  }
+
+  // Computes the preferred cluster of each movable hypernode. The hypergraph and the
+  // current clustering are only read, therefore the chunks can be processed in parallel.
+  void computeTargets(const std::vector<HypernodeID>& hns, ThreadPool& pool) {
+    const size_t num_threads = pool.numThreads();
+    const size_t num_chunks = (hns.size() + kChunkSize - 1) / kChunkSize;
+    const int seed = Randomize::instance().newRandomSeed();
+    const auto process_chunks = [&](const size_t thread) {
+        RatingMap& ratings = *_ratings[thread];
+        for (size_t chunk = thread; chunk < num_chunks; chunk += num_threads) {
+          Randomize::instance().setSeed(Randomize::deriveSeed(seed, static_cast<uint32_t>(chunk)));
+          const size_t end = std::min(hns.size(), (chunk + 1) * kChunkSize);
+          for (size_t i = chunk * kChunkSize; i < end; ++i) {
+            _target[hns[i]] = rate(hns[i], ratings);
+          }
+        }
+      };
+
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+      pool.enqueue([&process_chunks, thread]() {
+          process_chunks(thread);
+        });
+    }
+    pool.waitForAll();
+  }
+
+  HypernodeID rate(const HypernodeID u, RatingMap& ratings) const {
+    if (_in_cluster[u]) {
+      return kInvalidTarget;
+    }
+    const HypernodeWeight weight_u = _hg.nodeWeight(u);
+    for (const HyperedgeID& he : _hg.incidentEdges(u)) {
+      ASSERT(_hg.edgeSize(he) > 1, V(he));
+      if (_hg.edgeSize(he) <= _context.partition.hyperedge_size_threshold) {
+        const RatingType score = ScorePolicy::score(_hg, he, _context);
+        for (const HypernodeID& v : _hg.pins(he)) {
+          const HypernodeID cluster = _cluster[v];
+          if (v != u &&
+              _cluster_weight[cluster] + weight_u <= _context.coarsening.max_allowed_node_weight &&
+              RatingPartitionPolicy::accept(_hg, _context, cluster, u)) {
+            ratings[cluster] += score;
+          }
+        }
+      }
+    }
+
+    RatingType max_rating = std::numeric_limits<RatingType>::min();
+    HypernodeID target = kInvalidTarget;
+    for (auto it = ratings.end() - 1; it >= ratings.begin(); --it) {
+      const HypernodeID tmp_target = it->key;
+      const RatingType tmp_rating = it->value /
+                                    HeavyNodePenaltyPolicy::penalty(weight_u,
+                                                                    _cluster_weight[tmp_target]);
+      if (CommunityPolicy::sameCommunity(_hg.communities(), tmp_target, u) &&
+          AcceptancePolicy::acceptRating(tmp_rating, max_rating,
+                                         target, tmp_target, _in_cluster) &&
+          FixedVertexPolicy::acceptContraction(_hg, _context, tmp_target, u)) {
+        max_rating = tmp_rating;
+        target = tmp_target;
+      }
+    }
+    ratings.clear();
+    return target;
+  }
+
+  // Moves the hypernodes to their preferred clusters. Moves are skipped if the target
+  // joined another cluster in the meantime or if the cluster would become too heavy.
+  HypernodeID applyTargets(const std::vector<HypernodeID>& hns, const HypernodeID limit,
+                           HypernodeID num_hns_after_pass) {
+    for (const HypernodeID& hn : hns) {
+      if (num_hns_after_pass <= limit) {
+        break;
+      }
+      const HypernodeID target = _target[hn];
+      if (target == kInvalidTarget || _in_cluster[hn] || _cluster[target] != target ||
+          _cluster_weight[target] + _hg.nodeWeight(hn) >
+          _context.coarsening.max_allowed_node_weight) {
+        continue;
+      }
+      DBG << "Moving HN" << hn << "to cluster" << target;
+      _cluster[hn] = target;
+      _cluster_weight[target] += _hg.nodeWeight(hn);
+      _in_cluster.set(hn, true);
+      _in_cluster.set(target, true);
+      --num_hns_after_pass;
+    }
+    return num_hns_after_pass;
+  }
+
+  using Base::_pq;
+  using Base::_hg;
+  using Base::_context;
+  using Base::_history;
+  std::vector<HypernodeID> _cluster;
+  std::vector<HypernodeWeight> _cluster_weight;
+  std::vector<HypernodeID> _target;
+  ds::FastResetFlagArray<> _in_cluster;
+  std::vector<std::unique_ptr<RatingMap> > _ratings;
+};
+}  // namespace kahypar
@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/fast_reset_flag_array.h"
 #include "kahypar/definitions.h"
 #include "kahypar/meta/int_to_type.h"
 #include "kahypar/partition/coarsening/coarsener_base.h"
@@ -52,7 +53,8 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
   VertexPairCoarsenerBase(Hypergraph& hypergraph, const Context& context,
                           const HypernodeWeight weight_of_heaviest_node) :
     CoarsenerBase(hypergraph, context, weight_of_heaviest_node),
-    _pq(_hg.initialNumNodes()) { }
+    _pq(_hg.initialNumNodes()),
+    _uncontracted_in_batch(_hg.initialNumNodes()) { }
 
   ~VertexPairCoarsenerBase() override = default;
 
@@ -88,37 +90,58 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
     _context.stats.set(StatTag::InitialPartitioning, "initialImbalance", current_metrics.imbalance);
 
     initializeRefiner(refiner);
-    std::vector<HypernodeID> refinement_nodes(2, 0);
+    // Instead of refining after each uncontraction, up to batch_size consecutive
+    // contractions involving pairwise disjoint hypernodes are undone at once and
+    // refined by a single local search seeded with all uncontracted hypernodes.
+    const size_t batch_size = std::max(_context.local_search.uncontraction_batch_size,
+                                       static_cast<size_t>(1));
+    std::vector<HypernodeID> refinement_nodes;
+    refinement_nodes.reserve(2 * batch_size);
     UncontractionGainChanges changes;
     changes.representative.push_back(0);
     changes.contraction_partner.push_back(0);
+    UncontractionGainChanges batch_changes;
     while (!_history.empty()) {
-      restoreParallelHyperedges();
-      restoreSingleNodeHyperedges();
+      refinement_nodes.clear();
+      batch_changes.representative.clear();
+      batch_changes.contraction_partner.clear();
+      _uncontracted_in_batch.reset();
+      do {
+        const HypernodeID u = _history.back().contraction_memento.u;
+        const HypernodeID v = _history.back().contraction_memento.v;
+        _uncontracted_in_batch.set(u, true);
+        _uncontracted_in_batch.set(v, true);
 
-      DBG << "Uncontracting: (" << _history.back().contraction_memento.u << ","
-          << _history.back().contraction_memento.v << ")";
+        restoreParallelHyperedges();
+        restoreSingleNodeHyperedges();
 
-      refinement_nodes.clear();
-      refinement_nodes.push_back(_history.back().contraction_memento.u);
-      refinement_nodes.push_back(_history.back().contraction_memento.v);
+        DBG << "Uncontracting: (" << u << "," << v << ")";
 
-      if (_hg.currentNumNodes() > _max_hn_weights.back().num_nodes) {
-        _max_hn_weights.pop_back();
-      }
+        refinement_nodes.push_back(u);
+        refinement_nodes.push_back(v);
 
-      if (_context.local_search.algorithm == RefinementAlgorithm::twoway_fm ||
-          _context.local_search.algorithm == RefinementAlgorithm::twoway_fm_flow) {
-        _hg.uncontract(_history.back().contraction_memento, changes,
-                       meta::Int2Type<static_cast<int>(RefinementAlgorithm::twoway_fm)>());
-      } else {
-        _hg.uncontract(_history.back().contraction_memento);
-      }
+        if (_hg.currentNumNodes() > _max_hn_weights.back().num_nodes) {
+          _max_hn_weights.pop_back();
+        }
+
+        if (_context.local_search.algorithm == RefinementAlgorithm::twoway_fm ||
+            _context.local_search.algorithm == RefinementAlgorithm::twoway_fm_flow) {
+          _hg.uncontract(_history.back().contraction_memento, changes,
+                         meta::Int2Type<static_cast<int>(RefinementAlgorithm::twoway_fm)>());
+        } else {
+          _hg.uncontract(_history.back().contraction_memento);
+        }
+
+        batch_changes.representative.push_back(changes.representative[0]);
+        batch_changes.contraction_partner.push_back(changes.contraction_partner[0]);
+        changes.representative[0] = 0;
+        changes.contraction_partner[0] = 0;
+        _history.pop_back();
+      } while (refinement_nodes.size() < 2 * batch_size && !_history.empty() &&
+               !_uncontracted_in_batch[_history.back().contraction_memento.u] &&
+               !_uncontracted_in_batch[_history.back().contraction_memento.v]);
 
-      performLocalSearch(refiner, refinement_nodes, current_metrics, changes);
-      changes.representative[0] = 0;
-      changes.contraction_partner[0] = 0;
-      _history.pop_back();
+      performLocalSearch(refiner, refinement_nodes, current_metrics, batch_changes);
     }
 
     // This currently cannot be guaranteed for RB-partitioning and k != 2^x, since it might be
@@ -181,5 +204,6 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
   using CoarsenerBase::_hg;
   using CoarsenerBase::_context;
   PrioQueue _pq;
+  ds::FastResetFlagArray<> _uncontracted_in_batch;
 };
 }  // namespace kahypar
@@ -194,15 +194,18 @@ struct LocalSearchParameters {
     double alpha = std::numeric_limits<double>::max();
     size_t beta = std::numeric_limits<size_t>::max();
     bool use_most_balanced_minimum_cut = false;
+    size_t most_balanced_minimum_cut_sweeps = 20;
     bool use_adaptive_alpha_stopping_rule = false;
     bool ignore_small_hyperedge_cut = false;
     bool use_improvement_history = false;
+    bool use_warm_start = false;
   };
 
   FM fm { };
   Flow flow { };
   RefinementAlgorithm algorithm = RefinementAlgorithm::UNDEFINED;
   int iterations_per_level = std::numeric_limits<int>::max();
+  size_t uncontraction_batch_size = 1;
 };
 
 
@@ -210,9 +213,11 @@ inline std::ostream& operator<< (std::ostream& str, const LocalSearchParameters&
   str << "Local Search Parameters:" << std::endl;
   str << "  Algorithm:                          " << params.algorithm << std::endl;
   str << "  iterations per level:               " << params.iterations_per_level << std::endl;
+  str << "  uncontraction batch size:           " << params.uncontraction_batch_size << std::endl;
   if (params.algorithm == RefinementAlgorithm::twoway_fm ||
       params.algorithm == RefinementAlgorithm::kway_fm ||
       params.algorithm == RefinementAlgorithm::kway_fm_km1 ||
+      params.algorithm == RefinementAlgorithm::kway_fm_parallel_km1 ||
       params.algorithm == RefinementAlgorithm::twoway_fm_flow ||
       params.algorithm == RefinementAlgorithm::kway_fm_flow_km1 ||
       params.algorithm == RefinementAlgorithm::kway_fm_flow) {
@@ -234,6 +239,9 @@ inline std::ostream& operator<< (std::ostream& str, const LocalSearchParameters&
     str << "    execution policy:                 " << params.flow.execution_policy << std::endl;
     str << "    most balanced minimum cut:        "
         << std::boolalpha << params.flow.use_most_balanced_minimum_cut << std::endl;
+    if (params.flow.use_most_balanced_minimum_cut) {
+      str << "    # MBMC sweeps:                    " << params.flow.most_balanced_minimum_cut_sweeps << std::endl;
+    }
     str << "    alpha:                            " << params.flow.alpha << std::endl;
     if (params.flow.execution_policy == FlowExecutionMode::constant) {
       str << "    beta:                             " << params.flow.beta << std::endl;
@@ -244,6 +252,8 @@ inline std::ostream& operator<< (std::ostream& str, const LocalSearchParameters&
         << std::boolalpha << params.flow.ignore_small_hyperedge_cut << std::endl;
     str << "    use improvement history:          "
         << std::boolalpha << params.flow.use_improvement_history << std::endl;
+    str << "    warm start:                       "
+        << std::boolalpha << params.flow.use_warm_start << std::endl;
   } else if (params.algorithm == RefinementAlgorithm::do_nothing) {
     str << "  no coarsening!  " << std::endl;
   }
@@ -307,6 +317,7 @@ struct PartitioningParameters {
   int seed = 0;
   uint32_t global_search_iterations = std::numeric_limits<uint32_t>::max();
   int time_limit = 0;
+  size_t num_threads = 1;
 
   mutable uint32_t current_v_cycle = 0;
   std::vector<HypernodeWeight> perfect_balance_part_weights;
@@ -343,6 +354,7 @@ inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters
   str << "  seed:                               " << params.seed << std::endl;
   str << "  # V-cycles:                         " << params.global_search_iterations << std::endl;
   str << "  time limit:                         " << params.time_limit << "s" << std::endl;
+  str << "  # threads:                          " << params.num_threads << std::endl;
   str << "  hyperedge size threshold:           " << params.hyperedge_size_threshold << std::endl;
   str << "  use individual block weights:       " << std::boolalpha
       << params.use_individual_part_weights << std::endl;
@@ -387,6 +399,9 @@ struct EvolutionaryParameters {
   mutable std::vector<ClusterID> communities;
   bool unlimited_coarsening_contraction;
   bool random_vcycles;
+  // Island model: number of iterations of an island between two migrations (0 disables)
+  int migration_interval = 10;
+  EvoMigrationTopology migration_topology = EvoMigrationTopology::ring;
 };
 
 inline std::ostream& operator<< (std::ostream& str, const EvolutionaryParameters& params) {
@@ -398,6 +413,8 @@ inline std::ostream& operator<< (std::ostream& str, const EvolutionaryParameters
   str << "  Combine Strategy                    " << params.combine_strategy << std::endl;
   str << "  Mutation Strategy                   " << params.mutate_strategy << std::endl;
   str << "  Diversification Interval            " << params.diversify_interval << std::endl;
+  str << "  Migration Interval                  " << params.migration_interval << std::endl;
+  str << "  Migration Topology                  " << params.migration_topology << std::endl;
   return str;
 }
 
@@ -486,6 +503,7 @@ inline std::ostream& operator<< (std::ostream& str, const Context& context) {
 static inline void checkRecursiveBisectionMode(RefinementAlgorithm& algo) {
   if (algo == RefinementAlgorithm::kway_fm ||
       algo == RefinementAlgorithm::kway_fm_km1 ||
+      algo == RefinementAlgorithm::kway_fm_parallel_km1 ||
       algo == RefinementAlgorithm::kway_flow ||
       algo == RefinementAlgorithm::kway_fm_flow_km1) {
     LOG << "WARNING: local search algorithm is set to"
@@ -497,7 +515,8 @@ static inline void checkRecursiveBisectionMode(RefinementAlgorithm& algo) {
     std::cin >> answer;
     answer = std::toupper(answer);
     if (answer == 'Y') {
-      if (algo == RefinementAlgorithm::kway_fm || algo == RefinementAlgorithm::kway_fm_km1) {
+      if (algo == RefinementAlgorithm::kway_fm || algo == RefinementAlgorithm::kway_fm_km1 ||
+          algo == RefinementAlgorithm::kway_fm_parallel_km1) {
         algo = RefinementAlgorithm::twoway_fm;
       } else if (algo == RefinementAlgorithm::kway_flow) {
         algo = RefinementAlgorithm::twoway_flow;
@@ -639,6 +658,7 @@ static inline void sanityCheck(const Hypergraph& hypergraph, Context& context) {
   if (context.partition.mode == Mode::direct_kway &&
       context.partition.objective == Objective::cut) {
     if (context.local_search.algorithm == RefinementAlgorithm::kway_fm_km1 ||
+        context.local_search.algorithm == RefinementAlgorithm::kway_fm_parallel_km1 ||
         context.local_search.algorithm == RefinementAlgorithm::kway_fm_flow_km1) {
       LOG << "\nRefinement algorithm" << context.local_search.algorithm
           << "currently only works for connectivity (km1) optimization.";
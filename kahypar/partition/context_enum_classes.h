@@ -82,6 +82,7 @@ enum class CoarseningAlgorithm : uint8_t {
   heavy_full,
   heavy_lazy,
   ml_style,
+  parallel_lp,
   do_nothing,
   UNDEFINED
 };
@@ -95,6 +96,7 @@ enum class RefinementAlgorithm : uint8_t {
   kway_flow,
   kway_fm_flow_km1,
   kway_fm_flow,
+  kway_fm_parallel_km1,
   do_nothing,
   UNDEFINED
 };
@@ -153,6 +155,12 @@ enum class EvoMutateStrategy : uint8_t {
   UNDEFINED
 };
 
+enum class EvoMigrationTopology : uint8_t {
+  ring,
+  complete,
+  random
+};
+
 enum class EvoDecision :uint8_t {
   normal,
   mutation,
@@ -180,6 +188,16 @@ std::ostream& operator<< (std::ostream& os, const EvoCombineStrategy& combine) {
   return os << static_cast<uint8_t>(combine);
 }
 
+std::ostream& operator<< (std::ostream& os, const EvoMigrationTopology& topology) {
+  switch (topology) {
+    case EvoMigrationTopology::ring: return os << "ring";
+    case EvoMigrationTopology::complete: return os << "complete";
+    case EvoMigrationTopology::random: return os << "random";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(topology);
+}
+
 std::ostream& operator<< (std::ostream& os, const EvoMutateStrategy& mutation) {
   switch (mutation) {
     case EvoMutateStrategy::new_initial_partitioning_vcycle:
@@ -214,6 +232,7 @@ std::ostream& operator<< (std::ostream& os, const RatingPartitionPolicy& policy)
 enum class FlowAlgorithm : uint8_t {
   edmond_karp,
   goldberg_tarjan,
+  parallel_push_relabel,
   boykov_kolmogorov,
   ibfs,
   UNDEFINED
@@ -329,6 +348,7 @@ std::ostream& operator<< (std::ostream& os, const CoarseningAlgorithm& algo) {
     case CoarseningAlgorithm::heavy_full: return os << "heavy_full";
     case CoarseningAlgorithm::heavy_lazy: return os << "heavy_lazy";
     case CoarseningAlgorithm::ml_style: return os << "ml_style";
+    case CoarseningAlgorithm::parallel_lp: return os << "parallel_lp";
     case CoarseningAlgorithm::do_nothing: return os << "do_nothing";
     case CoarseningAlgorithm::UNDEFINED: return os << "UNDEFINED";
       // omit default case to trigger compiler warning for missing cases
@@ -346,6 +366,7 @@ std::ostream& operator<< (std::ostream& os, const RefinementAlgorithm& algo) {
     case RefinementAlgorithm::kway_flow: return os << "kway_flow";
     case RefinementAlgorithm::kway_fm_flow_km1: return os << "kway_fm_flow_km1";
     case RefinementAlgorithm::kway_fm_flow: return os << "kway_fm_flow";
+    case RefinementAlgorithm::kway_fm_parallel_km1: return os << "kway_fm_parallel_km1";
     case RefinementAlgorithm::do_nothing: return os << "do_nothing";
     case RefinementAlgorithm::UNDEFINED: return os << "UNDEFINED";
       // omit default case to trigger compiler warning for missing cases
@@ -400,6 +421,7 @@ std::ostream& operator<< (std::ostream& os, const FlowAlgorithm& algo) {
   switch (algo) {
     case FlowAlgorithm::edmond_karp: return os << "edmond_karp";
     case FlowAlgorithm::goldberg_tarjan: return os << "goldberg_tarjan";
+    case FlowAlgorithm::parallel_push_relabel: return os << "parallel_push_relabel";
     case FlowAlgorithm::boykov_kolmogorov: return os << "boykov_kolmogorov";
     case FlowAlgorithm::ibfs: return os << "ibfs";
     case FlowAlgorithm::UNDEFINED: return os << "UNDEFINED";
@@ -461,6 +483,18 @@ static EvoReplaceStrategy replaceStrategyFromString(const std::string& strat) {
   exit(0);
 }
 
+static EvoMigrationTopology migrationTopologyFromString(const std::string& topology) {
+  if (topology == "ring") {
+    return EvoMigrationTopology::ring;
+  } else if (topology == "complete") {
+    return EvoMigrationTopology::complete;
+  } else if (topology == "random") {
+    return EvoMigrationTopology::random;
+  }
+  LOG << "No valid migration topology. ";
+  exit(0);
+}
+
 static AcceptancePolicy acceptanceCriterionFromString(const std::string& crit) {
   if (crit == "best") {
     return AcceptancePolicy::best;
@@ -537,6 +571,8 @@ static CoarseningAlgorithm coarseningAlgorithmFromString(const std::string& type
     return CoarseningAlgorithm::heavy_lazy;
   } else if (type == "ml_style") {
     return CoarseningAlgorithm::ml_style;
+  } else if (type == "parallel_lp") {
+    return CoarseningAlgorithm::parallel_lp;
   }
   LOG << "Illegal option:" << type;
   exit(0);
@@ -560,6 +596,8 @@ static RefinementAlgorithm refinementAlgorithmFromString(const std::string& type
     return RefinementAlgorithm::kway_fm_flow_km1;
   } else if (type == "kway_fm_flow") {
     return RefinementAlgorithm::kway_fm_flow;
+  } else if (type == "kway_fm_parallel_km1") {
+    return RefinementAlgorithm::kway_fm_parallel_km1;
   } else if (type == "do_nothing") {
     return RefinementAlgorithm::do_nothing;
   }
@@ -643,6 +681,8 @@ static FlowAlgorithm flowAlgorithmFromString(const std::string& type) {
     return FlowAlgorithm::edmond_karp;
   } else if (type == "goldberg_tarjan") {
     return FlowAlgorithm::goldberg_tarjan;
+  } else if (type == "parallel_push_relabel") {
+    return FlowAlgorithm::parallel_push_relabel;
   } else if (type == "boykov_kolmogorov") {
     return FlowAlgorithm::boykov_kolmogorov;
   } else if (type == "ibfs") {
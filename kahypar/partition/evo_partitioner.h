@@ -23,6 +23,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <limits>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest_prod.h"
@@ -32,9 +35,12 @@
 #include "kahypar/partition/context_enum_classes.h"
 #include "kahypar/partition/evolutionary/combine.h"
 #include "kahypar/partition/evolutionary/diversifier.h"
+#include "kahypar/partition/evolutionary/migration.h"
 #include "kahypar/partition/evolutionary/mutate.h"
 #include "kahypar/partition/evolutionary/population.h"
 #include "kahypar/partition/evolutionary/probability_tables.h"
+#include "kahypar/utils/thread_pool.h"
+#include "kahypar/utils/timer.h"
 
 
 namespace kahypar {
@@ -45,14 +51,103 @@ class EvoPartitioner {
  public:
   explicit EvoPartitioner(const Context& context) :
     _timelimit(),
-    _population() {
+    _population(),
+    _island(0),
+    _migration(nullptr),
+    _last_emigrant_fitness(std::numeric_limits<HyperedgeWeight>::max()) {
     _timelimit = context.partition.time_limit;
   }
 
+  EvoPartitioner(const EvoPartitioner&) = delete;
+  EvoPartitioner& operator= (const EvoPartitioner&) = delete;
+
+  EvoPartitioner(EvoPartitioner&&) = delete;
+  EvoPartitioner& operator= (EvoPartitioner&&) = delete;
+
+  ~EvoPartitioner() = default;
+
   inline void partition(Hypergraph& hg, Context& context) {
     context.partition_evolutionary = true;
 
+    if (context.partition.num_threads > 1) {
+      partitionIslands(hg, context);
+    } else {
+      evolve(hg, context);
+    }
+    hg.reset();
+    hg.setPartition(_population.individualAt(_population.best()).partition());
+  }
+
+  std::vector<PartitionID> bestPartition() const {
+    return _population.individualAt(_population.best()).partition();
+  }
+
+ private:
+  FRIEND_TEST(TheEvoPartitioner, ProperlyGeneratesTheInitialPopulation);
+  FRIEND_TEST(TheEvoPartitioner, RespectsLimitsOfTheInitialPopulation);
+  FRIEND_TEST(TheEvoPartitioner, IsCorrectlyDecidingTheActions);
+  FRIEND_TEST(TheEvoPartitioner, ExchangesMigrantsBetweenIslands);
+  FRIEND_TEST(TheEvoPartitioner, ComputesABalancedPartitionUsingMultipleIslands);
+
+  // Island model: Each thread evolves its own population on its own copy of the
+  // hypergraph. Every migration_interval iterations, an island sends its best individual
+  // to the islands given by the migration topology and inserts the migrants it received
+  // into its population. Island i uses a seed derived from (seed, i).
+  inline void partitionIslands(const Hypergraph& hg, Context& context) {
+    const size_t num_islands = context.partition.num_threads;
+    // The islands only set up their own copies of the context.
+    context.setupPartWeights(hg.totalWeight());
+    Migration migration(num_islands, context.evolutionary.migration_topology);
+    std::vector<std::unique_ptr<EvoPartitioner> > islands;
+    std::vector<Timer::Timings> timings(num_islands);
+    for (size_t i = 0; i < num_islands; ++i) {
+      islands.emplace_back(std::make_unique<EvoPartitioner>(context));
+      islands.back()->_island = i;
+      islands.back()->_migration = &migration;
+    }
+
+    ThreadPool pool(num_islands);
+    for (size_t i = 0; i < num_islands; ++i) {
+      pool.enqueue([&, i]() {
+          Timer::instance().clear();
+          Randomize::instance().setSeed(Randomize::deriveSeed(context.partition.seed, i));
+          // Individuals store the partition of the island hypergraph. Since the input
+          // hypergraph does not contain removed hypernodes, reindexing does not change
+          // the hypernode IDs and migrants are valid on every island.
+          auto copy = ds::reindex(hg);
+          ASSERT([&]() {
+              for (HypernodeID hn = 0; hn < copy.second.size(); ++hn) {
+                if (copy.second[hn] != hn) {
+                  return false;
+                }
+              }
+              return copy.second.size() == hg.initialNumNodes();
+            } ());
+
+          Context island_context(context);
+          island_context.stats.detach();
+          island_context.partition.num_threads = 1;
+          island_context.partition.quiet_mode = true;
+          island_context.partition.seed = Randomize::deriveSeed(context.partition.seed, i);
 
+          islands[i]->evolve(*copy.first, island_context);
+          timings[i] = Timer::instance().releaseTimings(0);
+        });
+    }
+    pool.waitForAll();
+
+    size_t best_island = 0;
+    for (size_t i = 1; i < num_islands; ++i) {
+      if (islands[i]->_population.bestFitness() <
+          islands[best_island]->_population.bestFitness()) {
+        best_island = i;
+      }
+    }
+    _population = std::move(islands[best_island]->_population);
+    Timer::instance().addTimings(timings[best_island]);
+  }
+
+  inline void evolve(Hypergraph& hg, Context& context) {
     generateInitialPopulation(hg, context);
 
     while (Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit) {
@@ -80,19 +175,29 @@ class EvoPartitioner {
           LOG << "Error in evo_partitioner.h: Non-covered case in decision making";
           std::exit(EXIT_FAILURE);
       }
+
+      if (_migration != nullptr && context.evolutionary.migration_interval > 0 &&
+          context.evolutionary.iteration % context.evolutionary.migration_interval == 0) {
+        migrate(hg, context);
+      }
     }
-    hg.reset();
-    hg.setPartition(_population.individualAt(_population.best()).partition());
   }
 
-  const std::vector<PartitionID> & bestPartition() const {
-    return _population.individualAt(_population.best()).partition();
+  // The best individual only emigrates if it improved since the last migration.
+  inline void migrate(Hypergraph& hg, const Context& context) {
+    const Individual& best = _population.individualAt(_population.best());
+    if (best.fitness() < _last_emigrant_fitness) {
+      _last_emigrant_fitness = best.fitness();
+      _migration->emigrate(_island, best.partition());
+    }
+    for (const Migration::Migrant& migrant : _migration->immigrate(_island)) {
+      hg.setPartition(migrant);
+      const size_t insert_position = _population.insert(Individual(hg, context), context);
+      DBG << "Island" << _island << "inserted migrant at" << V(insert_position);
+    }
+    hg.reset();
   }
 
- private:
-  FRIEND_TEST(TheEvoPartitioner, ProperlyGeneratesTheInitialPopulation);
-  FRIEND_TEST(TheEvoPartitioner, RespectsLimitsOfTheInitialPopulation);
-  FRIEND_TEST(TheEvoPartitioner, IsCorrectlyDecidingTheActions);
   inline void generateInitialPopulation(Hypergraph& hg, Context& context) {
     // INITIAL POPULATION
     if (context.evolutionary.dynamic_population_size) {
@@ -226,5 +331,8 @@ class EvoPartitioner {
 
   int _timelimit;
   Population _population;
+  size_t _island;
+  Migration* _migration;
+  HyperedgeWeight _last_emigrant_fitness;
 };
 }  // namespace kahypar
@@ -41,8 +41,12 @@ Individual partitions(Hypergraph& hg,
   DBG << V(context.evolutionary.action.decision());
   DBG << "Parent 1: initial" << V(parents.first.fitness());
   DBG << "Parent 2: initial" << V(parents.second.fitness());
-  context.evolutionary.parent1 = &parents.first.partition();
-  context.evolutionary.parent2 = &parents.second.partition();
+  // Individuals store their partitions in packed form. The coarsener needs random access
+  // to the partitions of both parents.
+  const std::vector<PartitionID> parent1 = parents.first.partition();
+  const std::vector<PartitionID> parent2 = parents.second.partition();
+  context.evolutionary.parent1 = &parent1;
+  context.evolutionary.parent2 = &parent2;
 #ifndef NDEBUG
   ASSERT(parents.first.fitness() == ([](Hypergraph& hg, const Parents& parents) -> int {
         hg.setPartition(parents.first.partition());
@@ -75,6 +79,8 @@ Individual partitions(Hypergraph& hg,
                         std::chrono::duration<double>(end - start).count());
 
   context.coarsening.contraction_limit_multiplier = original_contraction_limit_multiplier;
+  context.evolutionary.parent1 = nullptr;
+  context.evolutionary.parent2 = nullptr;
   DBG << "Offspring" << V(metrics::km1(hg)) << V(metrics::imbalance(hg, context));
   ASSERT(metrics::km1(hg) <= std::min(parents.first.fitness(), parents.second.fitness()));
   io::serializer::serializeEvolutionary(context, hg);
@@ -20,59 +20,75 @@
 ******************************************************************************/
 #pragma once
 
+#include <algorithm>
+#include <cstdlib>
 #include <limits>
 #include <utility>
 #include <vector>
 
+#include "kahypar/datastructure/compressed_bitmap.h"
+#include "kahypar/datastructure/packed_partition.h"
 #include "kahypar/definitions.h"
 #include "kahypar/partition/metrics.h"
 
 namespace kahypar {
+// The partition is stored using ceil(log2(k)) bits per hypernode and the cut
+// hyperedges are stored as compressed bitmap. The strong cut edges, which contain
+// each cut hyperedge (connectivity - 1) times, are represented by the cut hyperedges
+// and the multiplicities of all hyperedges with connectivity > 2.
 class Individual {
  private:
   static constexpr bool debug = false;
 
+  using CutEdges = ds::CompressedBitmap<HyperedgeID>;
+  using Multiplicities = std::vector<std::pair<HyperedgeID, PartitionID> >;
+
  public:
   Individual() :
     _partition(),
     _cut_edges(),
-    _strong_cut_edges(),
+    _strong_cut_edge_multiplicities(),
     _fitness() { }
 
   explicit Individual(const HyperedgeWeight fitness) :
     _partition(),
     _cut_edges(),
-    _strong_cut_edges(),
+    _strong_cut_edge_multiplicities(),
     _fitness(fitness) { }
 
   explicit Individual(const std::vector<PartitionID>& partition) :
-    _partition(std::move(partition)),
+    _partition(partition,
+               partition.empty() ? 1 :
+               *std::max_element(partition.begin(), partition.end()) + 1),
     _cut_edges(),
-    _strong_cut_edges(),
+    _strong_cut_edge_multiplicities(),
     _fitness(std::numeric_limits<HyperedgeWeight>::max()) { }
 
   explicit Individual(const Hypergraph& hypergraph, const Context& context) :
-    _partition(),
+    _partition(hypergraph.currentNumNodes(), hypergraph.k()),
     _cut_edges(),
-    _strong_cut_edges(),
+    _strong_cut_edge_multiplicities(),
     _fitness() {
+    size_t i = 0;
     for (const HypernodeID& hn : hypergraph.nodes()) {
-      _partition.push_back(hypergraph.partID(hn));
+      _partition.set(i++, hypergraph.partID(hn));
     }
 
     _fitness = metrics::correctMetric(hypergraph, context);
 
+    std::vector<HyperedgeID> cut_edges;
     for (const HyperedgeID& he : hypergraph.edges()) {
       if (hypergraph.connectivity(he) > 1) {
-        _cut_edges.push_back(he);
+        cut_edges.push_back(he);
         // The general idea is to add the connectivity (#blocks - 1)
         // instead of the # of blocks (However there should not be that much of a difference)
-        // Edit: For Test Purposes this loop starts with 1.
-        for (PartitionID i = 1; i < hypergraph.connectivity(he); ++i) {
-          _strong_cut_edges.push_back(he);
+        if (hypergraph.connectivity(he) > 2) {
+          _strong_cut_edge_multiplicities.emplace_back(he, hypergraph.connectivity(he) - 1);
         }
       }
     }
+    _cut_edges = CutEdges(cut_edges, hypergraph.initialNumEdges());
+    _strong_cut_edge_multiplicities.shrink_to_fit();
     DBG << "New individual" << V(_fitness);
   }
 
@@ -87,53 +103,98 @@ class Individual {
     return _fitness;
   }
 
-
-  inline const std::vector<PartitionID> & partition() const {
+  inline std::vector<PartitionID> partition() const {
     ASSERT(!_partition.empty());
-    return _partition;
+    return _partition.unpack();
   }
-  inline const std::vector<HyperedgeID> & cutEdges() const {
+
+  inline std::vector<HyperedgeID> cutEdges() const {
+    ASSERT(!_cut_edges.empty());
+    return _cut_edges.elements();
+  }
+
+  inline std::vector<HyperedgeID> strongCutEdges() const {
     ASSERT(!_cut_edges.empty());
-    return _cut_edges;
+    std::vector<HyperedgeID> strong_cut_edges;
+    auto multiplicity = _strong_cut_edge_multiplicities.begin();
+    for (const HyperedgeID& he : _cut_edges.elements()) {
+      PartitionID num_copies = 1;
+      if (multiplicity != _strong_cut_edge_multiplicities.end() && multiplicity->first == he) {
+        num_copies = multiplicity->second;
+        ++multiplicity;
+      }
+      strong_cut_edges.insert(strong_cut_edges.end(), num_copies, he);
+    }
+    return strong_cut_edges;
   }
 
-  inline const std::vector<HyperedgeID> & strongCutEdges() const {
-    ASSERT(!_strong_cut_edges.empty());
-    return _strong_cut_edges;
+  // Size of the symmetric difference of the cut hyperedges of both individuals
+  inline size_t cutEdgeDifference(const Individual& other) const {
+    return _cut_edges.symmetricDifferenceSize(other._cut_edges);
   }
+
+  // Size of the symmetric difference of the strong cut edge multisets of both individuals.
+  // Hyperedges with connectivity <= 2 occur at most once in both multisets and are therefore
+  // covered by the difference of the cut hyperedges. For each hyperedge with connectivity > 2
+  // in at least one individual, this contribution is replaced by the difference of the
+  // multiplicities: If it only has connectivity > 2 in the first individual, it is cut in
+  // both individuals or only in the first one. In both cases, the correction is
+  // multiplicity - 1.
+  inline size_t strongCutEdgeDifference(const Individual& other) const {
+    size_t difference = cutEdgeDifference(other);
+    auto lhs = _strong_cut_edge_multiplicities.begin();
+    auto rhs = other._strong_cut_edge_multiplicities.begin();
+    const auto lhs_end = _strong_cut_edge_multiplicities.end();
+    const auto rhs_end = other._strong_cut_edge_multiplicities.end();
+    while (lhs != lhs_end || rhs != rhs_end) {
+      if (rhs == rhs_end || (lhs != lhs_end && lhs->first < rhs->first)) {
+        difference += lhs->second - 1;
+        ++lhs;
+      } else if (lhs == lhs_end || rhs->first < lhs->first) {
+        difference += rhs->second - 1;
+        ++rhs;
+      } else {
+        difference += std::abs(lhs->second - rhs->second);
+        ++lhs;
+        ++rhs;
+      }
+    }
+    return difference;
+  }
+
   inline void print() const {
     LOG << "Fitness:" << _fitness;
   }
   inline void printDebug() const {
     LOG << "Fitness:" << _fitness;
     LOG << "Partition :---------------------------------------";
-    for (const PartitionID part : _partition) {
+    for (const PartitionID part : partition()) {
       LLOG << part;
     }
     LOG << "\n--------------------------------------------------";
     LOG << "Cut Edges :---------------------------------------";
-    for (const HyperedgeID cut_edge : _cut_edges) {
+    for (const HyperedgeID cut_edge : cutEdges()) {
       LLOG << cut_edge;
     }
     LOG << "\n--------------------------------------------------";
     LOG << "Strong Cut Edges :--------------------------------";
-    for (const HyperedgeID strong_cut_edge :  _strong_cut_edges) {
+    for (const HyperedgeID strong_cut_edge :  strongCutEdges()) {
       LLOG << strong_cut_edge;
     }
     LOG << "\n--------------------------------------------------";
   }
 
  private:
-  std::vector<PartitionID> _partition;
-  std::vector<HyperedgeID> _cut_edges;
-  std::vector<HyperedgeID> _strong_cut_edges;
+  ds::PackedPartition _partition;
+  CutEdges _cut_edges;
+  Multiplicities _strong_cut_edge_multiplicities;
   HyperedgeWeight _fitness;
 };
 std::ostream& operator<< (std::ostream& os, const Individual& individual) {
   os << "Fitness: " << individual.fitness() << std::endl;
   os << "Partition:------------------------------------" << std::endl;
-  for (size_t i = 0; i < individual.partition().size(); ++i) {
-    os << individual.partition()[i] << " ";
+  for (const PartitionID part : individual.partition()) {
+    os << part << " ";
   }
   return os;
 }
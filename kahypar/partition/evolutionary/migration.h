@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context_enum_classes.h"
+#include "kahypar/utils/randomize.h"
+
+namespace kahypar {
+// Exchange of migrants between the islands of the parallel evolutionary partitioner.
+// Each island owns a mailbox that holds at most one migrant (i.e. partition) per
+// sending island. A newer migrant of the same sender replaces the older one, which
+// bounds the memory of the mailboxes if an island is slower than its neighbors.
+class Migration {
+ public:
+  using Migrant = std::vector<PartitionID>;
+
+  Migration(const size_t num_islands, const EvoMigrationTopology topology) :
+    _topology(topology),
+    _mailboxes(num_islands, std::vector<Migrant>(num_islands)),
+    _mailbox_mutexes(num_islands) { }
+
+  Migration(const Migration&) = delete;
+  Migration& operator= (const Migration&) = delete;
+
+  Migration(Migration&&) = delete;
+  Migration& operator= (Migration&&) = delete;
+
+  ~Migration() = default;
+
+  size_t numIslands() const {
+    return _mailboxes.size();
+  }
+
+  // Random targets are drawn from the thread-local random number generator of the
+  // calling island.
+  std::vector<size_t> targets(const size_t island) const {
+    ASSERT(island < numIslands());
+    std::vector<size_t> targets;
+    const size_t num_islands = numIslands();
+    if (num_islands < 2) {
+      return targets;
+    }
+    switch (_topology) {
+      case EvoMigrationTopology::ring:
+        targets.push_back((island + 1) % num_islands);
+        break;
+      case EvoMigrationTopology::complete:
+        for (size_t target = 0; target < num_islands; ++target) {
+          if (target != island) {
+            targets.push_back(target);
+          }
+        }
+        break;
+      case EvoMigrationTopology::random: {
+          size_t target = Randomize::instance().getRandomInt(0, num_islands - 2);
+          targets.push_back(target < island ? target : target + 1);
+          break;
+        }
+        // omit default case to trigger compiler warning for missing cases
+    }
+    return targets;
+  }
+
+  void emigrate(const size_t island, const Migrant& migrant) {
+    for (const size_t target : targets(island)) {
+      std::lock_guard<std::mutex> lock(_mailbox_mutexes[target]);
+      _mailboxes[target][island] = migrant;
+    }
+  }
+
+  // Returns the migrants that arrived since the last call, ordered by sending island.
+  std::vector<Migrant> immigrate(const size_t island) {
+    ASSERT(island < numIslands());
+    std::vector<Migrant> migrants;
+    std::lock_guard<std::mutex> lock(_mailbox_mutexes[island]);
+    for (Migrant& migrant : _mailboxes[island]) {
+      if (!migrant.empty()) {
+        migrants.emplace_back(std::move(migrant));
+        migrant.clear();
+      }
+    }
+    return migrants;
+  }
+
+ private:
+  const EvoMigrationTopology _topology;
+  std::vector<std::vector<Migrant> > _mailboxes;
+  std::vector<std::mutex> _mailbox_mutexes;
+};
+}  // namespace kahypar
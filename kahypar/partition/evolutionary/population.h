@@ -203,30 +203,11 @@ class Population {
   }
   inline size_t difference(const Individual& individual, const size_t position,
                            const bool strong_set) const {
-    std::vector<HyperedgeID> output_diff;
-    if (strong_set) {
-      ASSERT(std::is_sorted(_individuals[position].strongCutEdges().begin(),
-                            _individuals[position].strongCutEdges().end()));
-      ASSERT(std::is_sorted(individual.strongCutEdges().begin(),
-                            individual.strongCutEdges().end()));
-      std::set_symmetric_difference(_individuals[position].strongCutEdges().begin(),
-                                    _individuals[position].strongCutEdges().end(),
-                                    individual.strongCutEdges().begin(),
-                                    individual.strongCutEdges().end(),
-                                    std::back_inserter(output_diff));
-    } else {
-      ASSERT(std::is_sorted(_individuals[position].cutEdges().begin(),
-                            _individuals[position].cutEdges().end()));
-      ASSERT(std::is_sorted(individual.cutEdges().begin(),
-                            individual.cutEdges().end()));
-      std::set_symmetric_difference(_individuals[position].cutEdges().begin(),
-                                    _individuals[position].cutEdges().end(),
-                                    individual.cutEdges().begin(),
-                                    individual.cutEdges().end(),
-                                    std::back_inserter(output_diff));
-    }
-    DBG << V(output_diff.size());
-    return output_diff.size();
+    const size_t difference = strong_set ?
+                              _individuals[position].strongCutEdgeDifference(individual) :
+                              _individuals[position].cutEdgeDifference(individual);
+    DBG << V(difference);
+    return difference;
   }
 
  private:
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <memory>
 #include <stack>
 #include <vector>
 
@@ -35,6 +36,8 @@
 #include "kahypar/partition/refinement/kway_fm_cut_refiner.h"
 #include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
 #include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/thread_pool.h"
 
 namespace kahypar {
 template <typename Derived = Mandatory>
@@ -101,28 +104,38 @@ class InitialPartitionerBase {
     HyperedgeWeight best_quality = std::numeric_limits<HyperedgeWeight>::max();
     double best_imbalance = std::numeric_limits<double>::max();
     std::vector<PartitionID> best_partition(_hg.initialNumNodes(), 0);
-    for (uint32_t i = 0; i < _context.initial_partitioning.nruns; ++i) {
-      // hg.resetPartitioning() is called in initial_partition
-      static_cast<Derived*>(this)->initialPartition();
-
-      const HyperedgeWeight current_quality = obj == Objective::cut ?
-                                              metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
-      const double current_imbalance = metrics::imbalance(_hg, _context);
-      DBG << V(obj) << V(current_quality) << V(current_imbalance);
-
-      const bool equal_metric = current_quality == best_quality;
-      const bool improved_metric = current_quality < best_quality;
-      const bool improved_imbalance = current_imbalance < best_imbalance;
-      const bool is_feasible_partition = current_imbalance <= _context.partition.epsilon;
-      const bool is_best_cut_feasible_paritition = best_imbalance <= _context.partition.epsilon;
-
-      if ((improved_metric && (is_feasible_partition || improved_imbalance)) ||
-          (equal_metric && improved_imbalance) ||
-          (is_feasible_partition && !is_best_cut_feasible_paritition)) {
-        best_quality = current_quality;
-        best_imbalance = current_imbalance;
-        for (const HypernodeID& hn : _hg.nodes()) {
-          best_partition[hn] = _hg.partID(hn);
+    if (useParallelRuns(_context.initial_partitioning.nruns)) {
+      std::vector<InitialPartitioningRun> runs = parallelRuns(
+        _context.initial_partitioning.nruns,
+        [](Hypergraph& hypergraph, Context& context, const size_t) {
+          Derived partitioner(hypergraph, context);
+          partitioner.initialPartition();
+        });
+      for (InitialPartitioningRun& run : runs) {
+        DBG << V(obj) << V(run.quality) << V(run.imbalance);
+        if (isBetterInitialPartition(run.quality, run.imbalance, best_quality, best_imbalance)) {
+          best_quality = run.quality;
+          best_imbalance = run.imbalance;
+          best_partition.swap(run.partition);
+        }
+      }
+    } else {
+      for (uint32_t i = 0; i < _context.initial_partitioning.nruns; ++i) {
+        // hg.resetPartitioning() is called in initial_partition
+        static_cast<Derived*>(this)->initialPartition();
+
+        const HyperedgeWeight current_quality = obj == Objective::cut ?
+                                                metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
+        const double current_imbalance = metrics::imbalance(_hg, _context);
+        DBG << V(obj) << V(current_quality) << V(current_imbalance);
+
+        if (isBetterInitialPartition(current_quality, current_imbalance,
+                                     best_quality, best_imbalance)) {
+          best_quality = current_quality;
+          best_imbalance = current_imbalance;
+          for (const HypernodeID& hn : _hg.nodes()) {
+            best_partition[hn] = _hg.partID(hn);
+          }
         }
       }
     }
@@ -175,21 +188,15 @@ class InitialPartitionerBase {
                      _hg, _context));
       }
 
-#ifdef USE_BUCKET_QUEUE
-      HyperedgeID max_degree = 0;
+      HyperedgeWeight max_weighted_degree = 0;
       for (const HypernodeID& hn : _hg.nodes()) {
-        max_degree = std::max(max_degree, _hg.nodeDegree(hn));
-      }
-      HyperedgeWeight max_he_weight = 0;
-      for (const HyperedgeID& he : _hg.edges()) {
-        max_he_weight = std::max(max_he_weight, _hg.edgeWeight(he));
+        HyperedgeWeight weighted_degree = 0;
+        for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+          weighted_degree += _hg.edgeWeight(he);
+        }
+        max_weighted_degree = std::max(max_weighted_degree, weighted_degree);
       }
-      LOG << V(max_degree);
-      LOG << V(max_he_weight);
-      refiner->initialize(static_cast<HyperedgeWeight>(max_degree * max_he_weight));
-#else
-      refiner->initialize(0);
-#endif
+      refiner->initialize(max_weighted_degree);
 
       std::vector<HypernodeID> refinement_nodes;
       Metrics current_metrics = { metrics::hyperedgeCut(_hg),
@@ -283,6 +290,74 @@ class InitialPartitionerBase {
   }
 
  protected:
+  struct InitialPartitioningRun {
+    HyperedgeWeight quality = 0;
+    double imbalance = 0.0;
+    // indexed by the hypernodes of _hg
+    std::vector<PartitionID> partition = { };
+  };
+
+  // Acceptance criterion for the best of several initial partitions: A feasible
+  // partition always beats an infeasible one. Otherwise the objective decides and
+  // ties are broken by imbalance.
+  bool isBetterInitialPartition(const HyperedgeWeight quality, const double imbalance,
+                                const HyperedgeWeight best_quality,
+                                const double best_imbalance) const {
+    const bool equal_metric = quality == best_quality;
+    const bool improved_metric = quality < best_quality;
+    const bool improved_imbalance = imbalance < best_imbalance;
+    const bool is_feasible_partition = imbalance <= _context.partition.epsilon;
+    const bool is_best_cut_feasible_paritition = best_imbalance <= _context.partition.epsilon;
+    return (improved_metric && (is_feasible_partition || improved_imbalance)) ||
+           (equal_metric && improved_imbalance) ||
+           (is_feasible_partition && !is_best_cut_feasible_paritition);
+  }
+
+  bool useParallelRuns(const size_t num_runs) const {
+    return _context.partition.num_threads > 1 && num_runs > 1;
+  }
+
+  // Executes num_runs independent initial partitioning runs on a thread pool.
+  // Each run works on its own copy of the hypergraph and the context and seeds the
+  // random number generator of the executing thread with a seed derived from its
+  // index. The runs are returned in order, i.e., the best run can be selected
+  // deterministically regardless of the number of threads.
+  template <typename Run>
+  std::vector<InitialPartitioningRun> parallelRuns(const size_t num_runs, const Run& run) {
+    const int seed = Randomize::instance().newRandomSeed();
+    std::vector<InitialPartitioningRun> runs(num_runs);
+    std::vector<std::unique_ptr<Context> > contexts(num_runs);
+    {
+      ThreadPool pool(std::min(_context.partition.num_threads, num_runs));
+      for (size_t i = 0; i < num_runs; ++i) {
+        pool.enqueue([this, &run, &runs, &contexts, seed, i]() {
+            Randomize::instance().setSeed(Randomize::deriveSeed(seed, i));
+            auto copy = ds::reindex(_hg);
+            Hypergraph& hypergraph = *copy.first;
+            contexts[i] = std::make_unique<Context>(_context);
+            contexts[i]->stats.detach();
+            // runs of nested initial partitioners are executed sequentially
+            contexts[i]->partition.num_threads = 1;
+
+            run(hypergraph, *contexts[i], i);
+
+            runs[i].quality = _context.partition.objective == Objective::cut ?
+                              metrics::hyperedgeCut(hypergraph) : metrics::km1(hypergraph);
+            runs[i].imbalance = metrics::imbalance(hypergraph, *contexts[i]);
+            runs[i].partition.resize(_hg.initialNumNodes(), 0);
+            for (const HypernodeID& hn : hypergraph.nodes()) {
+              runs[i].partition[copy.second[hn]] = hypergraph.partID(hn);
+            }
+          });
+      }
+      pool.waitForAll();
+    }
+    for (const std::unique_ptr<Context>& context : contexts) {
+      _context.stats.topLevel().merge(context->stats);
+    }
+    return runs;
+  }
+
   Hypergraph& _hg;
   Context& _context;
 
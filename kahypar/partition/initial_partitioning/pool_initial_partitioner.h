@@ -21,6 +21,7 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -105,7 +106,9 @@ class PoolInitialPartitioner : public IInitialPartitioner,
 
  private:
   void partitionImpl() override final {
-    Base::multipleRunsInitialPartitioning();
+    // Pool partitioner executes each initial partitioner nruns times.
+    // Therefore the pool itself is executed only once.
+    initialPartition();
   }
 
   void initialPartition() {
@@ -117,54 +120,63 @@ class PoolInitialPartitioner : public IInitialPartitioner,
                                      kInvalidImbalance);
     PartitioningResult max_imbalance(InitialPartitionerAlgorithm::pool, obj, kInvalidCut, -0.1);
 
+    // Returns true, if the result is the new best partition
+    auto apply_result = [&](const InitialPartitionerAlgorithm algo,
+                            const HyperedgeWeight current_quality,
+                            const double current_imbalance) {
+        DBG << algo << V(obj) << V(current_quality) << V(current_imbalance);
+        const bool is_best = Base::isBetterInitialPartition(current_quality, current_imbalance,
+                                                            best_cut.quality, best_cut.imbalance);
+        if (is_best) {
+          applyPartitioningResults(best_cut, current_quality, current_imbalance, algo);
+        }
+        if (current_quality < min_cut.quality) {
+          applyPartitioningResults(min_cut, current_quality, current_imbalance, algo);
+        }
+        if (current_quality > max_cut.quality) {
+          applyPartitioningResults(max_cut, current_quality, current_imbalance, algo);
+        }
+        if (current_imbalance < min_imbalance.imbalance) {
+          applyPartitioningResults(min_imbalance, current_quality, current_imbalance, algo);
+        }
+        if (current_imbalance > max_imbalance.imbalance) {
+          applyPartitioningResults(max_imbalance, current_quality, current_imbalance, algo);
+        }
+        return is_best;
+      };
+
+    const std::vector<InitialPartitionerAlgorithm> algorithms = selectedAlgorithms();
     std::vector<PartitionID> best_partition(_hg.initialNumNodes());
-    unsigned int n = _partitioner_pool.size() - 1;
-    for (unsigned int i = 0; i <= n; ++i) {
-      // If the (n-i)th bit of pool_type is set we execute the corresponding
-      // initial partitioner (see constructor)
-      if (!((_context.initial_partitioning.pool_type >> (n - i)) & 1)) {
-        continue;
-      }
-      InitialPartitionerAlgorithm algo = _partitioner_pool[i];
-      if (algo == InitialPartitionerAlgorithm::greedy_round_maxpin ||
-          algo == InitialPartitionerAlgorithm::greedy_global_maxpin ||
-          algo == InitialPartitionerAlgorithm::greedy_sequential_maxpin) {
-        DBG << "skipping maxpin";
-        continue;
-      }
-      std::unique_ptr<IInitialPartitioner> partitioner(
-        InitialPartitioningFactory::getInstance().createObject(algo, _hg, _context));
-      partitioner->partition();
-      HyperedgeWeight current_quality = obj == Objective::cut ?
-                                        metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
-      double current_imbalance = metrics::imbalance(_hg, _context);
-      DBG << algo << V(obj) << V(current_quality) << V(current_imbalance);
-
-      const bool equal_metric = current_quality == best_cut.quality;
-      const bool improved_metric = current_quality < best_cut.quality;
-      const bool improved_imbalance = current_imbalance < best_cut.imbalance;
-      const bool is_feasible_partition = current_imbalance <= _context.partition.epsilon;
-      const bool is_best_cut_feasible_paritition = best_cut.imbalance <= _context.partition.epsilon;
-
-      if ((improved_metric && (is_feasible_partition || improved_imbalance)) ||
-          (equal_metric && improved_imbalance) ||
-          (is_feasible_partition && !is_best_cut_feasible_paritition)) {
-        for (const HypernodeID& hn : _hg.nodes()) {
-          best_partition[hn] = _hg.partID(hn);
+    if (Base::useParallelRuns(algorithms.size())) {
+      // The algorithms of the pool are independent of each other and are executed
+      // in parallel on their own copy of the hypergraph. The best result is then
+      // selected in the same order as in the sequential case.
+      std::vector<InitialPartitioningRun> runs = Base::parallelRuns(
+        algorithms.size(),
+        [&algorithms](Hypergraph& hypergraph, Context& context, const size_t i) {
+          std::unique_ptr<IInitialPartitioner> partitioner(
+            InitialPartitioningFactory::getInstance().createObject(algorithms[i],
+                                                                   hypergraph, context));
+          partitioner->partition();
+        });
+      for (size_t i = 0; i < algorithms.size(); ++i) {
+        if (apply_result(algorithms[i], runs[i].quality, runs[i].imbalance)) {
+          best_partition.swap(runs[i].partition);
         }
-        applyPartitioningResults(best_cut, current_quality, current_imbalance, algo);
       }
-      if (current_quality < min_cut.quality) {
-        applyPartitioningResults(min_cut, current_quality, current_imbalance, algo);
-      }
-      if (current_quality > max_cut.quality) {
-        applyPartitioningResults(max_cut, current_quality, current_imbalance, algo);
-      }
-      if (current_imbalance < min_imbalance.imbalance) {
-        applyPartitioningResults(min_imbalance, current_quality, current_imbalance, algo);
-      }
-      if (current_imbalance > max_imbalance.imbalance) {
-        applyPartitioningResults(max_imbalance, current_quality, current_imbalance, algo);
+    } else {
+      for (const InitialPartitionerAlgorithm& algo : algorithms) {
+        std::unique_ptr<IInitialPartitioner> partitioner(
+          InitialPartitioningFactory::getInstance().createObject(algo, _hg, _context));
+        partitioner->partition();
+        HyperedgeWeight current_quality = obj == Objective::cut ?
+                                          metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
+        double current_imbalance = metrics::imbalance(_hg, _context);
+        if (apply_result(algo, current_quality, current_imbalance)) {
+          for (const HypernodeID& hn : _hg.nodes()) {
+            best_partition[hn] = _hg.partID(hn);
+          }
+        }
       }
     }
 
@@ -197,11 +209,27 @@ class PoolInitialPartitioner : public IInitialPartitioner,
         }
         return true;
       } (), "There are unassigned hypernodes!");
+  }
 
-    // Pool Partitioner executes each initial partitioner nruns times.
-    // To prevent pool partitioner to execute himself nruns times, we
-    // set the nruns parameter to 1.
-    _context.initial_partitioning.nruns = 1;
+  std::vector<InitialPartitionerAlgorithm> selectedAlgorithms() const {
+    std::vector<InitialPartitionerAlgorithm> algorithms;
+    unsigned int n = _partitioner_pool.size() - 1;
+    for (unsigned int i = 0; i <= n; ++i) {
+      // If the (n-i)th bit of pool_type is set we execute the corresponding
+      // initial partitioner (see constructor)
+      if (!((_context.initial_partitioning.pool_type >> (n - i)) & 1)) {
+        continue;
+      }
+      InitialPartitionerAlgorithm algo = _partitioner_pool[i];
+      if (algo == InitialPartitionerAlgorithm::greedy_round_maxpin ||
+          algo == InitialPartitionerAlgorithm::greedy_global_maxpin ||
+          algo == InitialPartitionerAlgorithm::greedy_sequential_maxpin) {
+        DBG << "skipping maxpin";
+        continue;
+      }
+      algorithms.push_back(algo);
+    }
+    return algorithms;
   }
 
   void applyPartitioningResults(PartitioningResult& result, const HyperedgeWeight quality,
@@ -212,6 +240,7 @@ class PoolInitialPartitioner : public IInitialPartitioner,
     result.algo = algo;
   }
 
+  using InitialPartitioningRun = typename Base::InitialPartitioningRun;
   using Base::_hg;
   using Base::_context;
   std::vector<InitialPartitionerAlgorithm> _partitioner_pool;
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
 #include <queue>
 #include <utility>
 #include <vector>
@@ -30,8 +31,12 @@
 #include "kahypar/datastructure/hash_table.h"
 #include "kahypar/definitions.h"
 #include "kahypar/utils/hash_vector.h"
+#include "kahypar/utils/thread_pool.h"
 
 namespace kahypar {
+// If more than one thread is used (context.partition.num_threads), the min-hash
+// signatures of the vertices and the sorting of the buckets are computed in parallel.
+// The resulting clustering is the same as with a single thread.
 template <typename _HashPolicy>
 class AdaptiveLSHWithConnectedComponents {
  private:
@@ -44,6 +49,8 @@ class AdaptiveLSHWithConnectedComponents {
   using Buckets = HashBuckets<HashValue, HypernodeID>;
   using Pair = std::pair<HashValue, HypernodeID>;
 
+  static constexpr size_t kChunkSize = 1024;
+
  public:
   explicit AdaptiveLSHWithConnectedComponents(const Hypergraph& hypergraph,
                                               const Context& context) :
@@ -58,15 +65,27 @@ class AdaptiveLSHWithConnectedComponents {
     _new_buckets(),
     _base_hash_policy(0),
     _multiset_buckets(_hypergraph.currentNumNodes()),
-    _visited(_hypergraph.currentNumNodes()) {
+    _visited(_hypergraph.currentNumNodes()),
+    _pool() {
     _buckets.reserve(_hypergraph.currentNumNodes());
     _new_buckets.reserve(_hypergraph.currentNumNodes());
     _bfs_neighbours.reserve(_context.preprocessing.min_hash_sparsifier.max_hyperedge_size);
     _hash_set.reserve(_context.preprocessing.min_hash_sparsifier.combined_num_hash_functions);
     _base_hash_policy.reserveHashFunctions(
       _context.preprocessing.min_hash_sparsifier.combined_num_hash_functions);
+    if (_context.partition.num_threads > 1) {
+      _pool = std::make_unique<ThreadPool>(_context.partition.num_threads);
+    }
   }
 
+  AdaptiveLSHWithConnectedComponents(const AdaptiveLSHWithConnectedComponents&) = delete;
+  AdaptiveLSHWithConnectedComponents& operator= (const AdaptiveLSHWithConnectedComponents&) = delete;
+
+  AdaptiveLSHWithConnectedComponents(AdaptiveLSHWithConnectedComponents&&) = delete;
+  AdaptiveLSHWithConnectedComponents& operator= (AdaptiveLSHWithConnectedComponents&&) = delete;
+
+  ~AdaptiveLSHWithConnectedComponents() = default;
+
   std::vector<HypernodeID> build() {
     std::default_random_engine eng(_context.partition.seed);
     std::uniform_int_distribution<uint32_t> rnd;
@@ -184,19 +203,23 @@ class AdaptiveLSHWithConnectedComponents {
     for (size_t i = 0; i + 1 < min_hash_num; ++i) {
       _hash_set.addHashVector();
       _base_hash_policy.addHashFunction(rnd(eng));
-
-      _base_hash_policy.calculateLastHash(_hypergraph, active_vertices, _hash_set);
-
-      const uint32_t last_hash = _hash_set.getHashNum() - 1;
-      for (const auto& ver : active_vertices) {
-        _hashes[ver] ^= _hash_set[last_hash][ver];
-      }
     }
 
+    parallelFor(active_vertices.size(), [&](const size_t begin, const size_t end) {
+        _base_hash_policy.calculateHashes(_hypergraph, active_vertices.begin() + begin,
+                                          active_vertices.begin() + end, 0, _hash_set);
+        for (size_t i = begin; i < end; ++i) {
+          const HypernodeID ver = active_vertices[i];
+          for (uint32_t hash_num = 0; hash_num < _hash_set.getHashNum(); ++hash_num) {
+            _hashes[ver] ^= _hash_set[hash_num][ver];
+          }
+        }
+      });
+
     for (const auto& ver : active_vertices) {
       _buckets.emplace_back(_hashes[ver], ver);
     }
-    std::sort(_buckets.begin(), _buckets.end());
+    parallelSort(_buckets);
 
     while (remained_vertices > 0) {
       _hash_set.addHashVector();
@@ -204,6 +227,14 @@ class AdaptiveLSHWithConnectedComponents {
 
       const uint32_t last_hash = _hash_set.getHashNum() - 1;
 
+      // All remaining vertices need the value of the new hash function
+      parallelFor(_buckets.size(), [&](const size_t begin, const size_t end) {
+          _base_hash_policy.calculateHashes(_hypergraph,
+                                            BucketVertexIterator(_buckets.begin() + begin),
+                                            BucketVertexIterator(_buckets.begin() + end),
+                                            last_hash, _hash_set);
+        });
+
       // Decide for which vertices we continue to increase the number of hash functions
       _new_buckets.clear();
 
@@ -220,8 +251,6 @@ class AdaptiveLSHWithConnectedComponents {
           _vertices.push_back(it->second);
         }
 
-        _base_hash_policy.calculateLastHash(_hypergraph, _vertices, _hash_set);
-
         if (_vertices.size() == 1) {
           --remained_vertices;
           const HashValue hash = _hash_set[last_hash][_vertices.front()];
@@ -353,6 +382,80 @@ class AdaptiveLSHWithConnectedComponents {
     }
   }
 
+  // Calls f(begin, end) for chunks of [0, size). The chunks are processed in parallel
+  // if a thread pool is available.
+  template <typename F>
+  void parallelFor(const size_t size, const F& f) {
+    if (!_pool || size <= kChunkSize) {
+      f(0, size);
+      return;
+    }
+    const size_t num_threads = _pool->numThreads();
+    const size_t num_chunks = (size + kChunkSize - 1) / kChunkSize;
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+      _pool->enqueue([&, thread]() {
+          for (size_t chunk = thread; chunk < num_chunks; chunk += num_threads) {
+            f(chunk * kChunkSize, std::min(size, (chunk + 1) * kChunkSize));
+          }
+        });
+    }
+    _pool->waitForAll();
+  }
+
+  // Sorts one block per thread in parallel and merges the sorted blocks pairwise.
+  // Since all pairs are distinct, the result is the same as that of std::sort.
+  void parallelSort(std::vector<Pair>& pairs) {
+    if (!_pool || pairs.size() <= kChunkSize) {
+      std::sort(pairs.begin(), pairs.end());
+      return;
+    }
+    const size_t num_blocks = _pool->numThreads();
+    const size_t block_size = (pairs.size() + num_blocks - 1) / num_blocks;
+    const auto block_begin = [&](const size_t block) {
+        return pairs.begin() + std::min(pairs.size(), block * block_size);
+      };
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+      _pool->enqueue([&, block]() {
+          std::sort(block_begin(block), block_begin(block + 1));
+        });
+    }
+    _pool->waitForAll();
+
+    for (size_t width = 1; width < num_blocks; width *= 2) {
+      for (size_t block = 0; block + width < num_blocks; block += 2 * width) {
+        _pool->enqueue([&, block, width]() {
+            std::inplace_merge(block_begin(block), block_begin(block + width),
+                               block_begin(std::min(num_blocks, block + 2 * width)));
+          });
+      }
+      _pool->waitForAll();
+    }
+  }
+
+  // Iterates over the vertices of a range of buckets.
+  class BucketVertexIterator {
+   public:
+    explicit BucketVertexIterator(const typename std::vector<Pair>::const_iterator it) :
+      _it(it) { }
+
+    HypernodeID operator* () const {
+      return _it->second;
+    }
+
+    BucketVertexIterator& operator++ () {
+      ++_it;
+      return *this;
+    }
+
+    bool operator!= (const BucketVertexIterator& other) const {
+      return _it != other._it;
+    }
+
+   private:
+    typename std::vector<Pair>::const_iterator _it;
+  };
+
   const Hypergraph& _hypergraph;
   const Context& _context;
   std::vector<HypernodeID> _bfs_neighbours;
@@ -365,5 +468,6 @@ class AdaptiveLSHWithConnectedComponents {
   BaseHashPolicy _base_hash_policy;
   Buckets _multiset_buckets;
   ds::FastResetFlagArray<> _visited;
+  std::unique_ptr<ThreadPool> _pool;
 };
 }  // namespace kahypar
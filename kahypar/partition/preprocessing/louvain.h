@@ -22,10 +22,13 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <memory>
 #include <vector>
 
 #include "kahypar/datastructure/graph.h"
+#include "kahypar/datastructure/sparse_map.h"
 #include "kahypar/definitions.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
@@ -33,24 +36,39 @@
 #include "kahypar/partition/preprocessing/modularity.h"
 #include "kahypar/utils/randomize.h"
 #include "kahypar/utils/stats.h"
+#include "kahypar/utils/thread_pool.h"
 #include "kahypar/utils/timer.h"
 
 static constexpr bool debug = false;
 
 namespace kahypar {
+// If more than one thread is used (context.partition.num_threads), the local moving
+// phase and the contraction of the communities are performed in parallel. In each
+// local moving iteration, the best community of each node is computed in parallel
+// based on the clustering of the previous iteration (synchronous label updates). The
+// resulting moves are then applied in random order. A move is only applied if it still
+// improves the quality w.r.t. the current clustering, i.e., the quality never decreases.
+// Since no randomness is involved in the parallel phase, the communities do not depend
+// on the number of threads.
 template <class QualityMeasure = Mandatory,
           bool RandomizeNodes = true>
 class Louvain {
  private:
   using Edge = ds::Edge;
   using Graph = ds::Graph;
+  using IncidentClusterWeights = ds::SparseMap<ClusterID, EdgeWeight>;
+
+  static constexpr size_t kChunkSize = 1024;
 
  public:
   Louvain(const Hypergraph& hypergraph,
           const Context& context) :
     _graph_hierarchy(),
     _random_node_order(),
-    _context(context) {
+    _context(context),
+    _pool(),
+    _target(),
+    _incident_cluster_weights() {
     _graph_hierarchy.emplace_back(hypergraph, context);
   }
 
@@ -59,10 +77,21 @@ class Louvain {
           const Context& context) :
     _graph_hierarchy(),
     _random_node_order(),
-    _context(context) {
+    _context(context),
+    _pool(),
+    _target(),
+    _incident_cluster_weights() {
     _graph_hierarchy.emplace_back(adj_array, edges);
   }
 
+  Louvain(const Louvain&) = delete;
+  Louvain& operator= (const Louvain&) = delete;
+
+  Louvain(Louvain&&) = delete;
+  Louvain& operator= (Louvain&&) = delete;
+
+  ~Louvain() = default;
+
   EdgeWeight run() {
     bool improvement = false;
     size_t iteration = 0;
@@ -76,6 +105,15 @@ class Louvain {
     ASSERT(_graph_hierarchy.size() == 1);
     int cur_idx = 0;
 
+    if (_context.partition.num_threads > 1) {
+      _pool = std::make_unique<ThreadPool>(_context.partition.num_threads);
+      _target.resize(_graph_hierarchy[0].numNodes());
+      while (_incident_cluster_weights.size() < _pool->numThreads()) {
+        _incident_cluster_weights.emplace_back(
+          std::make_unique<IncidentClusterWeights>(_graph_hierarchy[0].numNodes()));
+      }
+    }
+
     do {
       DBG << "Graph Number Nodes:" << _graph_hierarchy[cur_idx].numNodes();
       DBG << "Graph Number Edges:" << _graph_hierarchy[cur_idx].numEdges();
@@ -100,7 +138,8 @@ class Louvain {
 
       old_quality = cur_quality;
       HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
-      cur_quality = louvain_pass(_graph_hierarchy[cur_idx], quality);
+      cur_quality = _pool ? parallel_louvain_pass(_graph_hierarchy[cur_idx], quality) :
+                    louvain_pass(_graph_hierarchy[cur_idx], quality);
       HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
       std::chrono::duration<double> elapsed_seconds = end - start;
       DBG << "Louvain-Pass #" << iteration << "Time:" << elapsed_seconds.count() << "s";
@@ -113,7 +152,8 @@ class Louvain {
         cur_quality = quality.quality();
         DBG << "Starting Contraction of communities...";
         start = std::chrono::high_resolution_clock::now();
-        auto contraction = _graph_hierarchy[cur_idx++].contractClusters();
+        auto contraction = _pool ? _graph_hierarchy[cur_idx++].contractClusters(*_pool) :
+                           _graph_hierarchy[cur_idx++].contractClusters();
         end = std::chrono::high_resolution_clock::now();
         elapsed_seconds = end - start;
         DBG << "Contraction Time:" << elapsed_seconds.count() << "s";
@@ -171,15 +211,7 @@ class Louvain {
     size_t node_moves = 0;
     uint32_t iterations = 0;
 
-    _random_node_order.clear();
-    for (const NodeID& node : graph.nodes()) {
-      _random_node_order.push_back(node);
-    }
-
-    // only false for testing purposes
-    if (RandomizeNodes) {
-      Randomize::instance().shuffleVector(_random_node_order, _random_node_order.size());
-    }
+    shuffleNodes(graph);
 
     // PERFORMANCE TUNING:
     // A node can only change its cluster if some of its incident clusters
@@ -249,9 +281,137 @@ class Louvain {
     return quality.quality();
   }
 
+  void shuffleNodes(const Graph& graph) {
+    _random_node_order.clear();
+    for (const NodeID& node : graph.nodes()) {
+      _random_node_order.push_back(node);
+    }
+
+    // only false for testing purposes
+    if (RandomizeNodes) {
+      Randomize::instance().shuffleVector(_random_node_order, _random_node_order.size());
+    }
+  }
+
+  // Computes the community with the best gain for the node based on the current
+  // clustering. Returns the current community if no move improves the quality.
+  ClusterID bestTarget(const Graph& graph, const QualityMeasure& quality, const NodeID node,
+                       IncidentClusterWeights& incident_cluster_weight) const {
+    const ClusterID cur_cid = graph.clusterID(node);
+    for (const Edge& e : graph.incidentEdges(node)) {
+      if (e.target_node != node) {
+        incident_cluster_weight[graph.clusterID(e.target_node)] += e.weight;
+      }
+    }
+
+    const EdgeWeight stay_gain = quality.gainWithoutRemoval(
+      node, cur_cid, incident_cluster_weight.contains(cur_cid) ?
+      incident_cluster_weight.get(cur_cid) : 0.0L);
+    ClusterID best_cid = cur_cid;
+    EdgeWeight best_gain = std::max(stay_gain, static_cast<EdgeWeight>(0.0L));
+    for (const auto& cluster : incident_cluster_weight) {
+      if (cluster.key != cur_cid) {
+        const EdgeWeight gain = quality.gainWithoutRemoval(node, cluster.key, cluster.value);
+        if (gain > best_gain) {
+          best_gain = gain;
+          best_cid = cluster.key;
+        }
+      }
+    }
+    incident_cluster_weight.clear();
+    return best_cid;
+  }
+
+  EdgeWeight parallel_louvain_pass(Graph& graph, QualityMeasure& quality) {
+    size_t node_moves = 0;
+    uint32_t iterations = 0;
+    shuffleNodes(graph);
+
+    // A node can only change its community if one of its incident communities
+    // changed in the previous iteration.
+    std::vector<uint8_t> cluster_changed(graph.numNodes(), true);
+    std::vector<uint8_t> next_cluster_changed(graph.numNodes(), false);
+    const auto incident_cluster_changed = [&](const NodeID node) {
+        if (cluster_changed[graph.clusterID(node)]) {
+          return true;
+        }
+        for (const Edge& e : graph.incidentEdges(node)) {
+          if (cluster_changed[graph.clusterID(e.target_node)]) {
+            return true;
+          }
+        }
+        return false;
+      };
+
+    const size_t num_threads = _pool->numThreads();
+    const size_t num_chunks = (_random_node_order.size() + kChunkSize - 1) / kChunkSize;
+    do {
+      ++iterations;
+      DBG << "######## Starting Parallel-Louvain-Pass-Iteration #" << iterations << "########";
+      node_moves = 0;
+
+      for (size_t thread = 0; thread < num_threads; ++thread) {
+        _pool->enqueue([&, thread]() {
+            IncidentClusterWeights& incident_cluster_weight = *_incident_cluster_weights[thread];
+            for (size_t chunk = thread; chunk < num_chunks; chunk += num_threads) {
+              const size_t end = std::min(_random_node_order.size(), (chunk + 1) * kChunkSize);
+              for (size_t i = chunk * kChunkSize; i < end; ++i) {
+                const NodeID node = _random_node_order[i];
+                _target[node] = incident_cluster_changed(node) ?
+                                bestTarget(graph, quality, node, incident_cluster_weight) :
+                                graph.clusterID(node);
+              }
+            }
+          });
+      }
+      _pool->waitForAll();
+
+      for (const NodeID& node : _random_node_order) {
+        const ClusterID cur_cid = graph.clusterID(node);
+        const ClusterID target = _target[node];
+        if (target == cur_cid) {
+          continue;
+        }
+        // Verify the move w.r.t. the moves that were already applied in this iteration.
+        EdgeWeight cur_incident_cluster_weight = 0.0L;
+        EdgeWeight target_incident_cluster_weight = 0.0L;
+        for (const Edge& e : graph.incidentEdges(node)) {
+          if (e.target_node != node) {
+            const ClusterID cid = graph.clusterID(e.target_node);
+            if (cid == cur_cid) {
+              cur_incident_cluster_weight += e.weight;
+            } else if (cid == target) {
+              target_incident_cluster_weight += e.weight;
+            }
+          }
+        }
+        const EdgeWeight target_gain =
+          quality.gainWithoutRemoval(node, target, target_incident_cluster_weight);
+        if (target_gain > 0.0L &&
+            target_gain > quality.gainWithoutRemoval(node, cur_cid, cur_incident_cluster_weight)) {
+          quality.remove(node, cur_incident_cluster_weight);
+          quality.insert(node, target, target_incident_cluster_weight);
+          next_cluster_changed[cur_cid] = true;
+          next_cluster_changed[target] = true;
+          ++node_moves;
+        }
+      }
+      cluster_changed.swap(next_cluster_changed);
+      std::fill(next_cluster_changed.begin(), next_cluster_changed.end(), false);
+
+      DBG << "Iteration #" << iterations << ": Moving" << node_moves << "nodes to new communities.";
+    } while (node_moves > 0 &&
+             iterations < _context.preprocessing.community_detection.max_pass_iterations);
+
+    return quality.quality();
+  }
+
   std::vector<Graph> _graph_hierarchy;
   std::vector<NodeID> _random_node_order;
   const Context& _context;
+  std::unique_ptr<ThreadPool> _pool;
+  std::vector<ClusterID> _target;
+  std::vector<std::unique_ptr<IncidentClusterWeights> > _incident_cluster_weights;
 };
 
 namespace internal {
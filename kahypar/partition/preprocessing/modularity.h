@@ -108,6 +108,20 @@ class Modularity {
   }
 
 
+  // Gain of inserting the node into cluster cid after removing it from its current
+  // cluster, computed without modifying the clustering. Only reads the clustering and
+  // can therefore be evaluated concurrently for different nodes.
+  EdgeWeight gainWithoutRemoval(const NodeID node, const ClusterID cid,
+                                const EdgeWeight incident_community_weight) const {
+    ASSERT(node < _graph.numNodes(), "NodeID" << node << "doesn't exist!");
+    const EdgeWeight w_degree = _graph.weightedDegree(node);
+    EdgeWeight totc = _total_weight[cid];
+    if (cid == _graph.clusterID(node)) {
+      totc -= w_degree;
+    }
+    return incident_community_weight - totc * w_degree / _graph.totalWeight();
+  }
+
   EdgeWeight quality() {
     EdgeWeight q = 0.0L;
     const EdgeWeight m2 = _graph.totalWeight();
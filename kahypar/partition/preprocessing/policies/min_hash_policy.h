@@ -85,6 +85,33 @@ class MinHashPolicy {
     }
   }
 
+  // calculates the minHashes of all hash functions in [first_hash, getHashNum()) for the
+  // vertices in [begin, end). In contrast to calculating one hash function at a time, the
+  // incident edges of each vertex are only traversed once and the minima of all hash
+  // functions are updated in a tight loop that the compiler can vectorize.
+  template <typename Iterator>
+  void calculateHashes(const Hypergraph& graph, const Iterator begin, const Iterator end,
+                       const size_t first_hash, MyHashSet& hash_set) const {
+    ALWAYS_ASSERT(getHashNum() > first_hash, "The number of hashes should be greater than zero");
+    const size_t num_hashes = _hash_func_vector.getHashNum() - first_hash;
+    std::vector<HashFunc> hash_functions(num_hashes);
+    for (size_t i = 0; i < num_hashes; ++i) {
+      hash_functions[i] = _hash_func_vector[first_hash + i];
+    }
+    std::vector<HashValue> min_hashes(num_hashes);
+    for (auto it = begin; it != end; ++it) {
+      std::fill(min_hashes.begin(), min_hashes.end(), std::numeric_limits<HashValue>::max());
+      for (const auto& value : graph.incidentEdges(*it)) {
+        for (size_t i = 0; i < num_hashes; ++i) {
+          min_hashes[i] = std::min(min_hashes[i], hash_functions[i](value));
+        }
+      }
+      for (size_t i = 0; i < num_hashes; ++i) {
+        hash_set[first_hash + i][*it] = min_hashes[i];
+      }
+    }
+  }
+
   HashValue combinedHash(const Hypergraph& graph, const VertexId vertex_id) const {
     ALWAYS_ASSERT(getHashNum() > 0, "The number of hashes should be greater than zero");
     HashValue val = 0;
@@ -21,6 +21,10 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <vector>
 
 #include "kahypar/definitions.h"
@@ -32,6 +36,9 @@
 #include "kahypar/partition/multilevel.h"
 #include "kahypar/partition/preprocessing/louvain.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/thread_pool.h"
+#include "kahypar/utils/timer.h"
 
 namespace kahypar {
 namespace recursive_bisection {
@@ -146,61 +153,122 @@ static inline Context createCurrentBisectionContext(const Context& original_cont
   return current_context;
 }
 
-static inline void partition(Hypergraph& input_hypergraph,
-                             const Context& original_context) {
-  // Custom deleters for Hypergraphs stored in hypergraph_stack. The top-level
-  // hypergraph is the input hypergraph, which is not supposed to be deleted.
-  // All extracted hypergraphs however can be deleted as soon as they are not needed
-  // anymore.
+static inline void bisect(Hypergraph& current_hypergraph,
+                          const Context& original_context,
+                          const Hypergraph& original_hypergraph,
+                          const PartitionID k1,
+                          const PartitionID k2,
+                          const int bisection_counter,
+                          const bool is_first_bisection) {
+  const PartitionID k = k2 - k1 + 1;
+  const PartitionID km = k / 2;
+
+  Context current_context =
+    createCurrentBisectionContext(original_context, original_hypergraph,
+                                  current_hypergraph, k, km, k - km, k1);
+  current_context.partition.rb_lower_k = k1;
+  current_context.partition.rb_upper_k = k2;
+
+  const bool direct_kway_verbose =
+    current_context.type == ContextType::initial_partitioning &&
+    current_context.initial_partitioning.verbose_output;
+  const bool recursive_bisection_verbose =
+    current_context.type == ContextType::main &&
+    current_context.partition.verbose_output;
+  const bool verbose_output = direct_kway_verbose || recursive_bisection_verbose;
+
+  if (verbose_output) {
+    LOG << "Recursive Bisection No." << bisection_counter << ": Computing blocks ("
+        << current_context.partition.rb_lower_k << ".."
+        << current_context.partition.rb_upper_k << ")";
+    LOG << "L_max0:" << current_context.partition.max_part_weights[0];
+    LOG << "L_max1:" << current_context.partition.max_part_weights[1];
+    LOG << R"(========================================)"
+           R"(========================================)";
+  }
+
+  if (current_context.preprocessing.enable_community_detection) {
+    if (recursive_bisection_verbose) {
+      LOG << "******************************************"
+             "**************************************";
+      LOG << "*                               Preprocessing..."
+             "                               *";
+      LOG << "*********************************************"
+             "***********************************";
+    }
+
+    // For both recursive bisection and direct k-way partitioning mode, we allow to reuse
+    // community structure information. Direct k-way partitioning uses recursive bisection
+    // as initial partitioning mode. Using the reuse_communities flag, we can therefore
+    // decide whether or not the community structure found before the first bisection
+    // (which corresponds to the community structure of the input hypergraph for recursive
+    // bisection based partitioning and to the community structure of the coarse hypergraph
+    // for direct k-way partitioning) should be reused in subsequent bisections. Note that
+    // the community structure computed in the top level preprocessing phase of direct k-way
+    // partitioning is not used here, because we clear the communities vector before calling
+    // the initial partitioner (see initial_partition.h).
+    const bool detect_communities =
+      !current_context.preprocessing.community_detection.reuse_communities ||
+      is_first_bisection;
+    if (detect_communities && current_hypergraph.initialNumNodes() > 0) {
+      detectCommunities(current_hypergraph, current_context);
+    } else if (verbose_output) {
+      LOG << "Reusing community structure computed in first bisection";
+    }
+  }
+
+
+  std::unique_ptr<ICoarsener> coarsener(
+    CoarsenerFactory::getInstance().createObject(
+      current_context.coarsening.algorithm,
+      current_hypergraph, current_context,
+      current_hypergraph.weightOfHeaviestNode()));
+
+  std::unique_ptr<IRefiner> refiner(
+    RefinerFactory::getInstance().createObject(
+      current_context.local_search.algorithm,
+      current_hypergraph, current_context));
+
+  ASSERT(coarsener.get() != nullptr, "coarsener not found");
+  ASSERT(refiner.get() != nullptr, "refiner not found");
+
+  if (current_hypergraph.initialNumNodes() > 0) {
+    multilevel::partition(current_hypergraph, *coarsener, *refiner, current_context);
+  }
+
+  if (verbose_output) {
+    LOG << R"(========================================)"
+           R"(========================================)";
+  }
+}
+
+static inline void sequentialPartition(Hypergraph& input_hypergraph,
+                                       const Context& original_context) {
   auto no_delete = [](Hypergraph*) { };
   auto delete_hypergraph = [](Hypergraph* h) {
                              delete h;
                            };
 
-  HypergraphPtr input_hypergraph_without_fixed_vertices = HypergraphPtr(nullptr, no_delete);
-  std::vector<HypernodeID> fixed_vertex_free_to_input;
-  if (input_hypergraph.containsFixedVertices()) {
-    // Remove fixed vertices from input hypergraph. Fixed vertices are
-    // added in a postprocessing step to the hypergraph after recursive
-    // bisection finished.
-    auto hg_without_fixed_vertices = ds::removeFixedVertices(input_hypergraph);
-    // The 'new' hypergraph without fixed vertices should be deleted.
-    input_hypergraph_without_fixed_vertices =
-      HypergraphPtr(hg_without_fixed_vertices.first.release(),
-                    delete_hypergraph);
-    fixed_vertex_free_to_input = hg_without_fixed_vertices.second;
-  } else {
-    // The original input hypergraph that did not contain any fixed vertices should not
-    // be deleted.
-    input_hypergraph_without_fixed_vertices = HypergraphPtr(&input_hypergraph, no_delete);
-  }
-
   std::vector<RBState> hypergraph_stack;
   MappingStack mapping_stack;
 
-  hypergraph_stack.emplace_back(HypergraphPtr(input_hypergraph_without_fixed_vertices.get(), no_delete),
+  hypergraph_stack.emplace_back(HypergraphPtr(&input_hypergraph, no_delete),
                                 RBHypergraphState::unpartitioned, 0,
                                 (original_context.partition.k - 1));
 
   int bisection_counter = 0;
 
-  if ((original_context.type == ContextType::main && original_context.partition.verbose_output) ||
-      (original_context.type == ContextType::initial_partitioning &&
-       original_context.initial_partitioning.verbose_output)) {
-    LOG << "================================================================================";
-  }
-
   while (!hypergraph_stack.empty()) {
     Hypergraph& current_hypergraph = *hypergraph_stack.back().hypergraph;
 
     if (hypergraph_stack.back().lower_k == hypergraph_stack.back().upper_k) {
       for (const HypernodeID& hn : current_hypergraph.nodes()) {
         const HypernodeID original_hn = originalHypernode(hn, mapping_stack);
-        const PartitionID current_part = input_hypergraph_without_fixed_vertices->partID(original_hn);
+        const PartitionID current_part = input_hypergraph.partID(original_hn);
         ASSERT(current_part != Hypergraph::kInvalidPartition, V(current_part));
         if (current_part != hypergraph_stack.back().lower_k) {
-          input_hypergraph_without_fixed_vertices->changeNodePart(original_hn, current_part,
-                                                                  hypergraph_stack.back().lower_k);
+          input_hypergraph.changeNodePart(original_hn, current_part,
+                                          hypergraph_stack.back().lower_k);
         }
       }
       hypergraph_stack.pop_back();
@@ -222,83 +290,12 @@ static inline void partition(Hypergraph& input_hypergraph,
         }
         break;
       case RBHypergraphState::unpartitioned: {
-          Context current_context =
-            createCurrentBisectionContext(original_context,
-                                          *input_hypergraph_without_fixed_vertices,
-                                          current_hypergraph, k, km, k - km, k1);
-          current_context.partition.rb_lower_k = k1;
-          current_context.partition.rb_upper_k = k2;
           ++bisection_counter;
-
-          const bool direct_kway_verbose =
-            current_context.type == ContextType::initial_partitioning &&
-            current_context.initial_partitioning.verbose_output;
-          const bool recursive_bisection_verbose =
-            current_context.type == ContextType::main &&
-            current_context.partition.verbose_output;
-          const bool verbose_output = direct_kway_verbose || recursive_bisection_verbose;
-
-          if (verbose_output) {
-            LOG << "Recursive Bisection No." << bisection_counter << ": Computing blocks ("
-                << current_context.partition.rb_lower_k << ".."
-                << current_context.partition.rb_upper_k << ")";
-            LOG << "L_max0:" << current_context.partition.max_part_weights[0];
-            LOG << "L_max1:" << current_context.partition.max_part_weights[1];
-            LOG << R"(========================================)"
-                   R"(========================================)";
-          }
-
-          if (current_context.preprocessing.enable_community_detection) {
-            if (recursive_bisection_verbose) {
-              LOG << "******************************************"
-                     "**************************************";
-              LOG << "*                               Preprocessing..."
-                     "                               *";
-              LOG << "*********************************************"
-                     "***********************************";
-            }
-
-            // For both recursive bisection and direct k-way partitioning mode, we allow to reuse
-            // community structure information. Direct k-way partitioning uses recursive bisection
-            // as initial partitioning mode. Using the reuse_communities flag, we can therefore
-            // decide whether or not the community structure found before the first bisection
-            // (which corresponds to the community structure of the input hypergraph for recursive
-            // bisection based partitioning and to the community structure of the coarse hypergraph
-            // for direct k-way partitioning) should be reused in subsequent bisections. Note that
-            // the community structure computed in the top level preprocessing phase of direct k-way
-            // partitioning is not used here, because we clear the communities vector before calling
-            // the initial partitioner (see initial_partition.h).
-            const bool detect_communities =
-              !current_context.preprocessing.community_detection.reuse_communities ||
-              bisection_counter == 1;
-            if (detect_communities && current_hypergraph.initialNumNodes() > 0) {
-              detectCommunities(current_hypergraph, current_context);
-            } else if (verbose_output) {
-              LOG << "Reusing community structure computed in first bisection";
-            }
-          }
-
-
-          std::unique_ptr<ICoarsener> coarsener(
-            CoarsenerFactory::getInstance().createObject(
-              current_context.coarsening.algorithm,
-              current_hypergraph, current_context,
-              current_hypergraph.weightOfHeaviestNode()));
-
-          std::unique_ptr<IRefiner> refiner(
-            RefinerFactory::getInstance().createObject(
-              current_context.local_search.algorithm,
-              current_hypergraph, current_context));
-
-          ASSERT(coarsener.get() != nullptr, "coarsener not found");
-          ASSERT(refiner.get() != nullptr, "refiner not found");
-
-          if (current_hypergraph.initialNumNodes() > 0) {
-            multilevel::partition(current_hypergraph, *coarsener, *refiner, current_context);
-          }
+          bisect(current_hypergraph, original_context, input_hypergraph, k1, k2,
+                 bisection_counter, bisection_counter == 1);
 
           auto extractedHypergraph_1 = ds::extractPartAsUnpartitionedHypergraphForBisection(
-            current_hypergraph, 1, current_context.partition.objective);
+            current_hypergraph, 1, original_context.partition.objective);
           mapping_stack.emplace_back(std::move(extractedHypergraph_1.second));
 
           hypergraph_stack.back().state =
@@ -306,11 +303,6 @@ static inline void partition(Hypergraph& input_hypergraph,
           hypergraph_stack.emplace_back(HypergraphPtr(extractedHypergraph_1.first.release(),
                                                       delete_hypergraph),
                                         RBHypergraphState::unpartitioned, k1 + km, k2);
-
-          if (verbose_output) {
-            LOG << R"(========================================)"
-                   R"(========================================)";
-          }
           break;
         }
       case RBHypergraphState::partitionedAndPart1Extracted: {
@@ -329,6 +321,193 @@ static inline void partition(Hypergraph& input_hypergraph,
         break;
     }
   }
+}
+
+// Parallel recursive bisection: After a bisection, both blocks are extracted
+// and the resulting sub-hypergraphs are bisected independently by the tasks of a
+// work-stealing thread pool. Each task uses its own context (and therefore its own
+// stats) and reseeds the random number generator of the executing thread with a
+// seed derived from the seed of its parent task. Thus the resulting partition only
+// depends on the seed and not on the number of threads or the order in which tasks
+// are executed.
+// Stats and timings of all tasks are merged in pre-order of the bisection tree.
+class ParallelRBTaskResult {
+ public:
+  ParallelRBTaskResult(const PartitionID lk, const PartitionID uk,
+                       std::unique_ptr<Context>&& c, Timer::Timings&& t) :
+    lower_k(lk),
+    upper_k(uk),
+    context(std::move(c)),
+    timings(std::move(t)) { }
+
+  PartitionID lower_k;
+  PartitionID upper_k;
+  std::unique_ptr<Context> context;
+  Timer::Timings timings;
+};
+
+class ParallelRBState {
+ public:
+  ParallelRBState(Hypergraph& hg, const Context& context) :
+    hypergraph(hg),
+    original_context(context),
+    partition(hg.initialNumNodes(), Hypergraph::kInvalidPartition),
+    mutex(),
+    results(),
+    bisection_counter(0),
+    pool(context.partition.num_threads) { }
+
+  ParallelRBState(const ParallelRBState&) = delete;
+  ParallelRBState& operator= (const ParallelRBState&) = delete;
+
+  ParallelRBState(ParallelRBState&&) = delete;
+  ParallelRBState& operator= (ParallelRBState&&) = delete;
+
+  ~ParallelRBState() = default;
+
+  Hypergraph& hypergraph;
+  const Context& original_context;
+  std::vector<PartitionID> partition;
+  std::mutex mutex;
+  std::vector<ParallelRBTaskResult> results;
+  std::atomic<int> bisection_counter;
+  // declared last to ensure that all tasks are finished before the
+  // remaining members are destroyed
+  ThreadPool pool;
+};
+
+static inline void parallelBisectionTask(ParallelRBState& rb_state,
+                                         std::shared_ptr<Hypergraph> current_hypergraph,
+                                         const std::vector<HypernodeID>& to_original,
+                                         const PartitionID k1,
+                                         const PartitionID k2,
+                                         const int seed) {
+  if (k1 == k2) {
+    for (const HypernodeID& hn : current_hypergraph->nodes()) {
+      rb_state.partition[to_original[hn]] = k1;
+    }
+    return;
+  }
+
+  Randomize::instance().setSeed(seed);
+  const size_t first_timing = Timer::instance().numTimings();
+  std::unique_ptr<Context> task_context = std::make_unique<Context>(rb_state.original_context);
+  task_context->stats.detach();
+
+  const PartitionID k = k2 - k1 + 1;
+  const PartitionID km = k / 2;
+  const bool is_first_bisection = (k1 == 0 && k2 == rb_state.original_context.partition.k - 1);
+  bisect(*current_hypergraph, *task_context, rb_state.hypergraph, k1, k2,
+         ++rb_state.bisection_counter, is_first_bisection);
+
+  auto extracted_hypergraph_0 = ds::extractPartAsUnpartitionedHypergraphForBisection(
+    *current_hypergraph, 0, task_context->partition.objective);
+  auto extracted_hypergraph_1 = ds::extractPartAsUnpartitionedHypergraphForBisection(
+    *current_hypergraph, 1, task_context->partition.objective);
+  current_hypergraph.reset();
+
+  std::vector<HypernodeID> to_original_0(extracted_hypergraph_0.second.size());
+  for (size_t hn = 0; hn < to_original_0.size(); ++hn) {
+    to_original_0[hn] = to_original[extracted_hypergraph_0.second[hn]];
+  }
+  std::vector<HypernodeID> to_original_1(extracted_hypergraph_1.second.size());
+  for (size_t hn = 0; hn < to_original_1.size(); ++hn) {
+    to_original_1[hn] = to_original[extracted_hypergraph_1.second[hn]];
+  }
+
+  const int seed_0 = Randomize::deriveSeed(seed, 0);
+  const int seed_1 = Randomize::deriveSeed(seed, 1);
+
+  {
+    std::lock_guard<std::mutex> lock(rb_state.mutex);
+    rb_state.results.emplace_back(k1, k2, std::move(task_context),
+                                  Timer::instance().releaseTimings(first_timing));
+  }
+
+  std::shared_ptr<Hypergraph> hypergraph_0(extracted_hypergraph_0.first.release());
+  std::shared_ptr<Hypergraph> hypergraph_1(extracted_hypergraph_1.first.release());
+  rb_state.pool.enqueue([&rb_state, hypergraph_1, to_original_1, k1, km, k2, seed_1]() {
+      parallelBisectionTask(rb_state, hypergraph_1, to_original_1, k1 + km, k2, seed_1);
+    });
+  rb_state.pool.enqueue([&rb_state, hypergraph_0, to_original_0, k1, km, seed_0]() {
+      parallelBisectionTask(rb_state, hypergraph_0, to_original_0, k1, k1 + km - 1, seed_0);
+    });
+}
+
+static inline void parallelPartition(Hypergraph& input_hypergraph,
+                                     const Context& original_context) {
+  ParallelRBState rb_state(input_hypergraph, original_context);
+
+  std::vector<HypernodeID> identity(input_hypergraph.initialNumNodes());
+  std::iota(identity.begin(), identity.end(), 0);
+  const int seed = Randomize::instance().newRandomSeed();
+  std::shared_ptr<Hypergraph> root(&input_hypergraph, [](Hypergraph*) { });
+  rb_state.pool.enqueue([&rb_state, root, &identity, seed]() {
+      parallelBisectionTask(rb_state, root, identity, 0,
+                            rb_state.original_context.partition.k - 1, seed);
+    });
+  rb_state.pool.waitForAll();
+
+  for (const HypernodeID& hn : input_hypergraph.nodes()) {
+    const PartitionID current_part = input_hypergraph.partID(hn);
+    ASSERT(current_part != Hypergraph::kInvalidPartition, V(current_part));
+    ASSERT(rb_state.partition[hn] != Hypergraph::kInvalidPartition, V(hn));
+    if (current_part != rb_state.partition[hn]) {
+      input_hypergraph.changeNodePart(hn, current_part, rb_state.partition[hn]);
+    }
+  }
+
+  std::sort(rb_state.results.begin(), rb_state.results.end(),
+            [](const ParallelRBTaskResult& lhs, const ParallelRBTaskResult& rhs) {
+        return lhs.lower_k < rhs.lower_k ||
+        (lhs.lower_k == rhs.lower_k && lhs.upper_k > rhs.upper_k);
+      });
+  for (ParallelRBTaskResult& result : rb_state.results) {
+    original_context.stats.topLevel().merge(result.context->stats);
+    Timer::instance().addTimings(result.timings);
+  }
+}
+
+static inline void partition(Hypergraph& input_hypergraph,
+                             const Context& original_context) {
+  // Custom deleters for Hypergraphs stored in hypergraph_stack. The top-level
+  // hypergraph is the input hypergraph, which is not supposed to be deleted.
+  // All extracted hypergraphs however can be deleted as soon as they are not needed
+  // anymore.
+  auto no_delete = [](Hypergraph*) { };
+  auto delete_hypergraph = [](Hypergraph* h) {
+                             delete h;
+                           };
+
+  HypergraphPtr input_hypergraph_without_fixed_vertices = HypergraphPtr(nullptr, no_delete);
+  std::vector<HypernodeID> fixed_vertex_free_to_input;
+  if (input_hypergraph.containsFixedVertices()) {
+    // Remove fixed vertices from input hypergraph. Fixed vertices are
+    // added in a postprocessing step to the hypergraph after recursive
+    // bisection finished.
+    auto hg_without_fixed_vertices = ds::removeFixedVertices(input_hypergraph);
+    // The 'new' hypergraph without fixed vertices should be deleted.
+    input_hypergraph_without_fixed_vertices =
+      HypergraphPtr(hg_without_fixed_vertices.first.release(),
+                    delete_hypergraph);
+    fixed_vertex_free_to_input = hg_without_fixed_vertices.second;
+  } else {
+    // The original input hypergraph that did not contain any fixed vertices should not
+    // be deleted.
+    input_hypergraph_without_fixed_vertices = HypergraphPtr(&input_hypergraph, no_delete);
+  }
+
+  if ((original_context.type == ContextType::main && original_context.partition.verbose_output) ||
+      (original_context.type == ContextType::initial_partitioning &&
+       original_context.initial_partitioning.verbose_output)) {
+    LOG << "================================================================================";
+  }
+
+  if (original_context.partition.num_threads > 1) {
+    parallelPartition(*input_hypergraph_without_fixed_vertices, original_context);
+  } else {
+    sequentialPartition(*input_hypergraph_without_fixed_vertices, original_context);
+  }
 
   if (input_hypergraph.containsFixedVertices()) {
     io::printMaximumWeightedBipartiteMatchingBanner(original_context);
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "kahypar/definitions.h"
@@ -89,13 +90,15 @@ class TwoWayFMFlowRefiner final : public IRefiner,
     // Therefore, we have to prevent that the FM Refiner will update the
     // values twice. Consequently, we set the delta updates to 0.
     UncontractionGainChanges modified_changes;
-    modified_changes.representative.push_back(changes.representative[0]);
-    modified_changes.contraction_partner.push_back(changes.contraction_partner[0]);
+    modified_changes.representative = changes.representative;
+    modified_changes.contraction_partner = changes.contraction_partner;
     if (flow_improvement) {
       const std::vector<Move> moves = _flow_refiner->rollbackPartition();
       _fm_refiner->performMovesAndUpdateCache(moves, refinement_nodes, changes);
-      modified_changes.representative[0] = 0;
-      modified_changes.contraction_partner[0] = 0;
+      std::fill(modified_changes.representative.begin(),
+                modified_changes.representative.end(), 0);
+      std::fill(modified_changes.contraction_partner.begin(),
+                modified_changes.contraction_partner.end(), 0);
     }
 
     const bool fm_improvement = _fm_refiner->refine(refinement_nodes, max_allowed_part_weights,
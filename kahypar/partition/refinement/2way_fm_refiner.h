@@ -139,12 +139,7 @@ class TwoWayFMRefiner final : public IRefiner,
 
   void initializeImpl(const HyperedgeWeight max_gain) override final {
     if (!_is_initialized) {
-#ifdef USE_BUCKET_QUEUE
       _pq.initialize(_hg.initialNumNodes(), max_gain);
-#else
-      unused(max_gain);
-      _pq.initialize(_hg.initialNumNodes());
-#endif
       _is_initialized = true;
     }
     _gain_cache.clear();
@@ -179,15 +174,24 @@ class TwoWayFMRefiner final : public IRefiner,
 
   void updateGainCacheAfterUncontraction(std::vector<HypernodeID>& refinement_nodes,
                                          const UncontractionGainChanges& changes) {
-    // Will always be the case in the first FM pass, since the just uncontracted HN
-    // was not seen before.
-    ASSERT(changes.representative.size() == 1, V(changes.representative.size()));
-    ASSERT(changes.contraction_partner.size() == 1, V(changes.contraction_partner.size()));
-    if (!_gain_cache.isCached(refinement_nodes[1]) && _gain_cache.isCached(refinement_nodes[0])) {
-      // In further FM passes, changes will be set to 0 by the caller.
-      _gain_cache.setValue(refinement_nodes[1], _gain_cache.value(refinement_nodes[0])
-                           + changes.contraction_partner[0]);
-      _gain_cache.updateValue(refinement_nodes[0], changes.representative[0]);
+    // The i-th entry of changes belongs to the uncontraction of refinement_nodes[2i]
+    // and refinement_nodes[2i + 1]. If a batch of independent contractions is undone
+    // at once, there is one entry for each of them.
+    ASSERT(changes.representative.size() == changes.contraction_partner.size(),
+           V(changes.representative.size()) << V(changes.contraction_partner.size()));
+    ASSERT(refinement_nodes.size() >= 2 * changes.representative.size(),
+           V(refinement_nodes.size()) << V(changes.representative.size()));
+    for (size_t i = 0; i < changes.representative.size(); ++i) {
+      const HypernodeID representative = refinement_nodes[2 * i];
+      const HypernodeID contraction_partner = refinement_nodes[2 * i + 1];
+      // Will always be the case in the first FM pass, since the just uncontracted HN
+      // was not seen before.
+      if (!_gain_cache.isCached(contraction_partner) && _gain_cache.isCached(representative)) {
+        // In further FM passes, changes will be set to 0 by the caller.
+        _gain_cache.setValue(contraction_partner, _gain_cache.value(representative)
+                             + changes.contraction_partner[i]);
+        _gain_cache.updateValue(representative, changes.representative[i]);
+      }
     }
   }
 
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <array>
+#include <chrono>
 #include <queue>
 #include <string>
 #include <utility>
@@ -39,6 +40,8 @@
 #include "kahypar/partition/refinement/flow/policies/flow_region_build_policy.h"
 #include "kahypar/partition/refinement/flow/quotient_graph_block_scheduler.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/stats.h"
 
 namespace kahypar {
 template <class Network = Mandatory>
@@ -68,7 +71,8 @@ class TwoWayFlowRefiner final : public IRefiner,
     _visited(_hg.initialNumNodes() + _hg.initialNumEdges()),
     _block0(0),
     _block1(1),
-    _ignore_flow_execution_policy(false) { }
+    _ignore_flow_execution_policy(false),
+    _performed_moves() { }
 
   TwoWayFlowRefiner(const TwoWayFlowRefiner&) = delete;
   TwoWayFlowRefiner(TwoWayFlowRefiner&&) = delete;
@@ -94,6 +98,11 @@ class TwoWayFlowRefiner final : public IRefiner,
     _ignore_flow_execution_policy = ignoreFlowExecutionPolicy;
   }
 
+  // ! Moves that were applied to the quotient graph during the last call to refine.
+  const std::vector<Move>& performedMoves() const {
+    return _performed_moves;
+  }
+
  private:
   friend class TwoWayFlowRefinerTest;
 
@@ -105,6 +114,7 @@ class TwoWayFlowRefiner final : public IRefiner,
                   const std::array<HypernodeWeight, 2>&,
                   const UncontractionGainChanges&,
                   Metrics& best_metrics) override final {
+    _performed_moves.clear();
     if (!_flow_execution_policy.executeFlow(_hg) && !_ignore_flow_execution_policy) {
       return false;
     }
@@ -130,6 +140,9 @@ class TwoWayFlowRefiner final : public IRefiner,
 
     bool improvement = false;
     double alpha = _context.local_search.flow.alpha * 2.0;
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    size_t num_augmentations = 0;
+    _flow_network.clearStoredFlow();
 
     // Adaptive Flow Iterations
     do {
@@ -151,6 +164,7 @@ class TwoWayFlowRefiner final : public IRefiner,
       //            in the quotient graph with a small cut
       if (_context.local_search.flow.ignore_small_hyperedge_cut &&
           cut_weight <= 10 && !isRefinementOnLastLevel()) {
+        updateStats(start, num_augmentations);
         return improvement;
       }
 
@@ -160,7 +174,7 @@ class TwoWayFlowRefiner final : public IRefiner,
         break;
       }
 
-      std::random_shuffle(cut_hes.begin(), cut_hes.end());
+      Randomize::instance().shuffleVector(cut_hes, cut_hes.size());
 
       // Build Flow Problem
       CutBuildPolicy::buildFlowNetwork(_hg, _context, _flow_network,
@@ -173,6 +187,7 @@ class TwoWayFlowRefiner final : public IRefiner,
 
       // Find minimum (S,T)-bipartition
       const HyperedgeWeight cut_flow_network_after = _maximum_flow->minimumSTCut(_block0, _block1);
+      num_augmentations += _maximum_flow->numAugmentations();
 
       // Maximum Flow algorithm returns infinity, if all
       // hypernodes contained in the flow problem are either
@@ -232,6 +247,7 @@ class TwoWayFlowRefiner final : public IRefiner,
           const PartitionID to = _maximum_flow->getOriginalPartition(hn);
           if (from != to) {
             _quotient_graph->changeNodePart(hn, from, to);
+            _performed_moves.emplace_back(hn, from, to);
           }
         }
       }
@@ -243,9 +259,16 @@ class TwoWayFlowRefiner final : public IRefiner,
           !improvement && cut_flow_network_before == cut_flow_network_after) {
         break;
       }
+
+      // The flow problem of the next iteration is built around the same cut
+      // hyperedges and therefore shares most of its flow carrying edges.
+      if (_context.local_search.flow.use_warm_start) {
+        _flow_network.storeFlow();
+      }
     } while (alpha > 1.0);
 
     printMetric(true, true);
+    updateStats(start, num_augmentations);
 
     // Delete quotient graph
     if (delete_quotientgraph_after_flow) {
@@ -256,6 +279,14 @@ class TwoWayFlowRefiner final : public IRefiner,
     return improvement;
   }
 
+  void updateStats(const HighResClockTimepoint& start, const size_t num_augmentations) {
+    const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    const std::string block_pair = std::to_string(_block0) + "_" + std::to_string(_block1);
+    _context.stats.add(StatTag::LocalSearch, "flowAugmentations_" + block_pair, num_augmentations);
+    _context.stats.add(StatTag::LocalSearch, "flowTime_" + block_pair,
+                       std::chrono::duration<double>(end - start).count());
+  }
+
   bool isRefinementOnLastLevel() {
     return _hg.currentNumNodes() == _hg.initialNumNodes();
   }
@@ -291,5 +322,6 @@ class TwoWayFlowRefiner final : public IRefiner,
   PartitionID _block0;
   PartitionID _block1;
   bool _ignore_flow_execution_policy;
+  std::vector<Move> _performed_moves;
 };
 }  // namespace kahypar
@@ -24,8 +24,11 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <memory>
 #include <queue>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -39,6 +42,8 @@
 #include "kahypar/partition/refinement/flow/flow_refiner_base.h"
 #include "kahypar/partition/refinement/flow/quotient_graph_block_scheduler.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/thread_pool.h"
 
 namespace kahypar {
 using ds::SparseSet;
@@ -51,14 +56,46 @@ class KWayFlowRefiner final : public IRefiner,
  private:
   using FlowNetwork = typename FlowNetworkPolicy::Network;
   using Base = FlowRefinerBase<FlowExecutionPolicy>;
+  using TwoWayRefiner = TwoWayFlowRefiner<FlowNetworkPolicy, FlowExecutionPolicy>;
+  using BlockPair = std::pair<PartitionID, PartitionID>;
 
   static constexpr bool debug = false;
 
+  // Each worker solves its flow problems on its own copy of the current hypergraph.
+  // The copies are kept in sync with the original hypergraph after each matching.
+  struct Worker {
+    Worker(const Hypergraph& original, const Context& context, const HyperedgeWeight max_gain) :
+      hypergraph(),
+      to_original(),
+      to_local(original.initialNumNodes(), 0),
+      scheduler(),
+      refiner() {
+      std::tie(hypergraph, to_original) = ds::reindex(original);
+      for (HypernodeID hn = 0; hn < to_original.size(); ++hn) {
+        to_local[to_original[hn]] = hn;
+        hypergraph->setNodePart(hn, original.partID(to_original[hn]));
+      }
+      hypergraph->initializeNumCutHyperedges();
+      scheduler = std::make_unique<QuotientGraphBlockScheduler>(*hypergraph, context);
+      scheduler->buildQuotientGraph();
+      refiner = std::make_unique<TwoWayRefiner>(*hypergraph, context);
+      refiner->initialize(max_gain);
+    }
+
+    std::unique_ptr<Hypergraph> hypergraph;
+    std::vector<HypernodeID> to_original;
+    std::vector<HypernodeID> to_local;
+    std::unique_ptr<QuotientGraphBlockScheduler> scheduler;
+    std::unique_ptr<TwoWayRefiner> refiner;
+  };
+
  public:
   KWayFlowRefiner(Hypergraph& hypergraph, const Context& context) :
     Base(hypergraph, context),
     _twoway_flow_refiner(_hg, _context),
-    _num_improvements(context.partition.k, std::vector<size_t>(context.partition.k, 0)) { }
+    _num_improvements(context.partition.k, std::vector<size_t>(context.partition.k, 0)),
+    _max_gain(0),
+    _pair_moves() { }
 
   KWayFlowRefiner(const KWayFlowRefiner&) = delete;
   KWayFlowRefiner(KWayFlowRefiner&&) = delete;
@@ -91,6 +128,10 @@ class KWayFlowRefiner final : public IRefiner,
     DBG << V(_hg.currentNumNodes()) << V(_hg.initialNumNodes());
     printMetric();
 
+    if (_context.partition.num_threads > 1 && _context.partition.k > 3) {
+      return refineInParallel(best_metrics);
+    }
+
     // Initialize Quotient Graph
     // 1.) Contains edges between each adjacent block of the partition
     // 2.) Contains for each edge all hyperedges, which are cut in the
@@ -150,6 +191,157 @@ class KWayFlowRefiner final : public IRefiner,
     return improvement;
   }
 
+  // Parallel version of active block scheduling: The quotient graph edges of a round
+  // are split into matchings. The block pairs of a matching are disjoint, therefore
+  // their flow problems are independent and can be solved at the same time. Since
+  // each pair only moves hypernodes between its own two blocks, the improvements of
+  // the pairs of a matching add up.
+  bool refineInParallel(Metrics& best_metrics) {
+    QuotientGraphBlockScheduler scheduler(_hg, _context);
+    scheduler.buildQuotientGraph();
+
+    const size_t num_workers = std::min(_context.partition.num_threads,
+                                        static_cast<size_t>(_context.partition.k / 2));
+    ThreadPool pool(num_workers);
+    std::vector<std::unique_ptr<Worker> > workers(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+      pool.enqueue([&, i]() {
+          workers[i] = std::make_unique<Worker>(_hg, _context, _max_gain);
+        });
+    }
+    pool.waitForAll();
+
+    bool improvement = false;
+    bool active_block_exist = true;
+    std::vector<bool> active_blocks(_context.partition.k, true);
+    std::vector<bool> matched(_context.partition.k, false);
+    std::vector<BlockPair> pending;
+    std::vector<BlockPair> matching;
+    size_t current_round = 1;
+    while (active_block_exist) {
+      scheduler.randomShuffleQoutientEdges();
+      std::vector<bool> tmp_active_blocks(_context.partition.k, false);
+      active_block_exist = false;
+      pending.clear();
+      for (const auto& e : scheduler.qoutientGraphEdges()) {
+        const bool improved_before = !_context.local_search.flow.use_improvement_history ||
+                                     current_round == 1 || _num_improvements[e.first][e.second] > 0;
+        if (improved_before && (active_blocks[e.first] || active_blocks[e.second])) {
+          pending.push_back(e);
+        }
+      }
+
+      while (!pending.empty()) {
+        // Greedily build a matching in the order of the shuffled quotient graph edges.
+        // All remaining block pairs are scheduled in one of the following matchings.
+        std::fill(matched.begin(), matched.end(), false);
+        matching.clear();
+        size_t num_remaining = 0;
+        for (const BlockPair& e : pending) {
+          if (!matched[e.first] && !matched[e.second]) {
+            matched[e.first] = true;
+            matched[e.second] = true;
+            matching.push_back(e);
+          } else {
+            pending[num_remaining++] = e;
+          }
+        }
+        pending.resize(num_remaining);
+
+        const std::vector<uint8_t> improved = refineMatching(matching, workers, pool,
+                                                             best_metrics);
+        for (size_t i = 0; i < matching.size(); ++i) {
+          if (improved[i]) {
+            const PartitionID block_0 = matching[i].first;
+            const PartitionID block_1 = matching[i].second;
+            DBG << "Improvement found beetween blocks " << block_0 << " and "
+                << block_1 << " in round #"
+                << current_round;
+            improvement = true;
+            active_block_exist = true;
+            tmp_active_blocks[block_0] = true;
+            tmp_active_blocks[block_1] = true;
+            _num_improvements[block_0][block_1]++;
+          }
+        }
+        printMetric();
+      }
+      current_round++;
+      std::swap(active_blocks, tmp_active_blocks);
+    }
+
+    printMetric(true, true);
+
+    return improvement;
+  }
+
+  // Solves the flow problems of all block pairs of the matching in parallel and
+  // transfers the resulting moves to the hypergraph and to all workers.
+  std::vector<uint8_t> refineMatching(const std::vector<BlockPair>& matching,
+                                      std::vector<std::unique_ptr<Worker> >& workers,
+                                      ThreadPool& pool,
+                                      Metrics& best_metrics) {
+    const size_t num_active_workers = std::min(workers.size(), matching.size());
+    const int seed = Randomize::instance().newRandomSeed();
+    std::vector<uint8_t> improved(matching.size(), false);
+    std::vector<HyperedgeWeight> delta(matching.size(), 0);
+    if (_pair_moves.size() < matching.size()) {
+      _pair_moves.resize(matching.size());
+    }
+    for (size_t w = 0; w < num_active_workers; ++w) {
+      pool.enqueue([&, w]() {
+          Worker& worker = *workers[w];
+          std::vector<HypernodeID> refinement_nodes;
+          const std::array<HypernodeWeight, 2> max_allowed_part_weights = { { 0, 0 } };
+          UncontractionGainChanges changes;
+          Metrics metrics = best_metrics;
+          for (size_t i = w; i < matching.size(); i += num_active_workers) {
+            Randomize::instance().setSeed(Randomize::deriveSeed(seed, static_cast<uint32_t>(i)));
+            const HyperedgeWeight metric_before =
+              metrics.getMetric(_context.partition.mode, _context.partition.objective);
+            worker.refiner->updateConfiguration(matching[i].first, matching[i].second,
+                                                worker.scheduler.get(), true);
+            improved[i] = worker.refiner->refine(refinement_nodes, max_allowed_part_weights,
+                                                 changes, metrics);
+            delta[i] = metric_before -
+                       metrics.getMetric(_context.partition.mode, _context.partition.objective);
+            // Remember the moves, since the next call to refine overrides them.
+            _pair_moves[i].clear();
+            for (const Move& move : worker.refiner->performedMoves()) {
+              _pair_moves[i].emplace_back(worker.to_original[move.hn], move.from, move.to);
+            }
+          }
+        });
+    }
+    pool.waitForAll();
+
+    HyperedgeWeight total_delta = 0;
+    for (size_t i = 0; i < matching.size(); ++i) {
+      total_delta += delta[i];
+      const size_t producer = i % num_active_workers;
+      for (const Move& move : _pair_moves[i]) {
+        _hg.changeNodePart(move.hn, move.from, move.to);
+        for (size_t w = 0; w < workers.size(); ++w) {
+          if (w != producer) {
+            workers[w]->scheduler->changeNodePart(workers[w]->to_local[move.hn],
+                                                  move.from, move.to);
+          }
+        }
+      }
+    }
+    if (total_delta != 0) {
+      best_metrics.updateMetric(best_metrics.getMetric(_context.partition.mode,
+                                                       _context.partition.objective) - total_delta,
+                                _context.partition.mode, _context.partition.objective);
+    }
+    best_metrics.imbalance = metrics::imbalance(_hg, _context);
+    ASSERT(best_metrics.getMetric(_context.partition.mode, _context.partition.objective) ==
+           metrics::objective(_hg, _context.partition.objective),
+           V(best_metrics.getMetric(_context.partition.mode, _context.partition.objective))
+           << V(metrics::objective(_hg, _context.partition.objective)));
+    return improved;
+  }
+
   void printMetric(bool newline = false, bool endline = false) {
     if (newline) {
       DBG << "";
@@ -164,6 +356,7 @@ class KWayFlowRefiner final : public IRefiner,
 
   void initializeImpl(const HyperedgeWeight max_gain) override final {
     _is_initialized = true;
+    _max_gain = max_gain;
     _flow_execution_policy.initialize(_hg, _context);
     _twoway_flow_refiner.initialize(max_gain);
   }
@@ -177,5 +370,7 @@ class KWayFlowRefiner final : public IRefiner,
 
   TwoWayFlowRefiner<FlowNetworkPolicy, FlowExecutionPolicy> _twoway_flow_refiner;
   std::vector<std::vector<size_t> > _num_improvements;
+  HyperedgeWeight _max_gain;
+  std::vector<std::vector<Move> > _pair_moves;
 };
 }  // namespace kahypar
@@ -22,6 +22,8 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <queue>
 #include <unordered_map>
 #include <utility>
@@ -40,6 +42,7 @@
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/flow/most_balanced_minimum_cut.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/thread_pool.h"
 
 namespace kahypar {
 template <class Network = Mandatory>
@@ -53,7 +56,8 @@ class MaximumFlow {
     _visited(flow_network.initialSize()),
     _Q(),
     _mbmc(hypergraph, _context, flow_network),
-    _original_part_id(_hg.initialNumNodes(), 0) { }
+    _original_part_id(_hg.initialNumNodes(), 0),
+    _num_augmentations(0) { }
 
   virtual ~MaximumFlow() { }
 
@@ -64,10 +68,15 @@ class MaximumFlow {
   MaximumFlow& operator= (MaximumFlow&&) = delete;
 
 
+  // Computes a maximum flow starting from the current flow of the flow network.
+  // Returns the value by which the flow was increased.
   virtual Flow maximumFlow() = 0;
 
+  // If the flow network stores the flow of a previous flow problem (see
+  // FlowNetwork::storeFlow), it is used as initial flow.
   HyperedgeWeight minimumSTCut(const PartitionID block_0, const PartitionID block_1) {
     if (_flow_network.isTrivialFlow()) {
+      _flow_network.clearStoredFlow();
       return Network::kInfty;
     }
 
@@ -78,7 +87,9 @@ class MaximumFlow {
       moveHypernode(hn, default_part);
     }
 
-    const HyperedgeWeight cut = maximumFlow();
+    _num_augmentations = 0;
+    const Flow initial_flow = _flow_network.restoreFlow();
+    const HyperedgeWeight cut = initial_flow + maximumFlow();
 
     if (_context.local_search.flow.use_most_balanced_minimum_cut) {
       _mbmc.mostBalancedMinimumCut(block_0, block_1);
@@ -103,6 +114,12 @@ class MaximumFlow {
     return _original_part_id[hn];
   }
 
+  // Number of augmenting paths (EdmondKarp) or pushes (push-relabel algorithms) of the last
+  // minimum (S,T)-cut computation. The external flow algorithms do not report it.
+  size_t numAugmentations() const {
+    return _num_augmentations;
+  }
+
   template <bool assign_hypernodes = false>
   bool bfs(const PartitionID block = 0) {
     bool augmenting_path_exists = false;
@@ -216,6 +233,7 @@ class MaximumFlow {
   MostBalancedMinimumCut<Network> _mbmc;
 
   std::vector<PartitionID> _original_part_id;
+  size_t _num_augmentations;
 };
 
 template <class Network = Mandatory>
@@ -240,6 +258,7 @@ class EdmondKarp : public MaximumFlow<Network>{
       for (const NodeID& t : _flow_network.sinks()) {
         if (_parent.get(t) != nullptr) {
           max_flow += Base::augment(t);
+          ++_num_augmentations;
         }
       }
     }
@@ -257,6 +276,7 @@ class EdmondKarp : public MaximumFlow<Network>{
   using Base::_context;
   using Base::_flow_network;
   using Base::_parent;
+  using Base::_num_augmentations;
 };
 
 
@@ -362,6 +382,7 @@ class GoldbergTarjan : public MaximumFlow<Network>{
             const Flow initial_push = std::min(initial_infinity, _flow_network.residualCapacity(e));
             _excess.update(target, initial_push);
             _flow_network.increaseFlow(e, initial_push);
+            ++_num_augmentations;
             enqueue(target);
           }
         }
@@ -384,6 +405,7 @@ class GoldbergTarjan : public MaximumFlow<Network>{
     _excess.update(u, -delta);
     _excess.update(v, delta);
     _flow_network.increaseFlow(e, delta);
+    ++_num_augmentations;
 
     enqueue(v);
     ASSERT(_flow_network.residualCapacity(_flow_network.reverseEdge(e)),
@@ -498,6 +520,7 @@ class GoldbergTarjan : public MaximumFlow<Network>{
   using Base::_flow_network;
   using Base::_visited;
   using Base::_Q;
+  using Base::_num_augmentations;
 
   size_t _num_nodes;
   FastResetArray<Flow> _excess;
@@ -510,6 +533,309 @@ class GoldbergTarjan : public MaximumFlow<Network>{
 };
 
 
+// Synchronous parallel push-relabel algorithm. Each round discharges all active
+// nodes in parallel using the distance labels of the previous round. Since a push
+// over edge (u,v) requires d(u) = d(v) + 1, no edge is pushed on from both sides
+// within the same round. Excess received during a round and new distance labels
+// only take effect in the next round. Nodes that cannot reach a sink return their
+// excess to the sources (distance labels >= n), such that the result is a valid
+// flow. The distance labels are periodically recomputed by parallel BFS from the
+// sinks and the sources (global relabeling).
+template <class Network = Mandatory>
+class ParallelPushRelabel : public MaximumFlow<Network>{
+  using Base = MaximumFlow<Network>;
+
+  static constexpr size_t kChunkSize = 1024;
+
+ public:
+  ParallelPushRelabel(Hypergraph& hypergraph, const Context& context, Network& flow_network) :
+    Base(hypergraph, context, flow_network),
+    _pool(),
+    _num_nodes(0),
+    _excess(flow_network.initialSize(), 0),
+    _added_excess(flow_network.initialSize()),
+    _distance(flow_network.initialSize(), 0),
+    _new_distance(flow_network.initialSize(), 0),
+    _in_next_round(flow_network.initialSize()),
+    _discovered(flow_network.initialSize()),
+    _active(),
+    _next_active(),
+    _thread_local_nodes(),
+    _work(0) {
+    if (_context.partition.num_threads > 1) {
+      _pool = std::make_unique<ThreadPool>(_context.partition.num_threads);
+    }
+    _thread_local_nodes.resize(numThreads());
+  }
+
+  ~ParallelPushRelabel() = default;
+
+  ParallelPushRelabel(const ParallelPushRelabel&) = delete;
+  ParallelPushRelabel& operator= (const ParallelPushRelabel&) = delete;
+
+  ParallelPushRelabel(ParallelPushRelabel&&) = delete;
+  ParallelPushRelabel& operator= (ParallelPushRelabel&&) = delete;
+
+  Flow maximumFlow() {
+    _num_nodes = _flow_network.numNodes();
+    init();
+    globalRelabeling();
+
+    while (!_active.empty()) {
+      discharge();
+      if (_work > _num_nodes + _flow_network.numEdges()) {
+        globalRelabeling();
+      }
+    }
+
+    ASSERT([&]() {
+        for (const NodeID& node : _flow_network.nodes()) {
+          if (!isTerminal(node) && _excess[node] > 0) {
+            return false;
+          }
+        }
+        return true;
+      } (), "After maximum flow execution no node should have a remaining excess!");
+
+    ASSERT(!Base::bfs(), "Found augmenting path after flow computation finished!");
+
+    Flow max_flow = 0;
+    for (const NodeID& t : _flow_network.sinks()) {
+      max_flow += _added_excess[t];
+    }
+    return max_flow;
+  }
+
+ private:
+  template <typename T>
+  FRIEND_TEST(AMaximumFlow, ChecksIfAugmentingPathExist);
+  template <typename T>
+  FRIEND_TEST(AMaximumFlow, AugmentAlongPath);
+
+  size_t numThreads() const {
+    return _pool ? _pool->numThreads() : 1;
+  }
+
+  bool isTerminal(const NodeID node) {
+    return _flow_network.isSource(node) || _flow_network.isSink(node);
+  }
+
+  // Calls f(thread, begin, end) for chunks of [0, size). The chunks are processed
+  // in parallel if a thread pool is available.
+  template <typename F>
+  void parallelFor(const size_t size, const F& f) {
+    if (!_pool || size <= kChunkSize) {
+      f(0, 0, size);
+      return;
+    }
+    const size_t num_threads = _pool->numThreads();
+    const size_t num_chunks = (size + kChunkSize - 1) / kChunkSize;
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+      _pool->enqueue([&, thread]() {
+          for (size_t chunk = thread; chunk < num_chunks; chunk += num_threads) {
+            f(thread, chunk * kChunkSize, std::min(size, (chunk + 1) * kChunkSize));
+          }
+        });
+    }
+    _pool->waitForAll();
+  }
+
+  // Moves the nodes collected by the threads to nodes.
+  void collectThreadLocalNodes(std::vector<NodeID>& nodes) {
+    nodes.clear();
+    for (std::vector<NodeID>& thread_local_nodes : _thread_local_nodes) {
+      nodes.insert(nodes.end(), thread_local_nodes.begin(), thread_local_nodes.end());
+      thread_local_nodes.clear();
+    }
+  }
+
+  // Saturates all edges leaving the sources. As in GoldbergTarjan, edges with
+  // infinite capacity receive the total weight of all hyperedges.
+  void init() {
+    const NodeID* nodes = _flow_network.nodes().first;
+    parallelFor(_num_nodes, [&](const size_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          _excess[nodes[i]] = 0;
+          _added_excess[nodes[i]] = 0;
+          _in_next_round[nodes[i]] = false;
+        }
+      });
+
+    const Flow initial_infinity = _flow_network.totalWeightHyperedges();
+    for (const NodeID& s : _flow_network.sources()) {
+      for (FlowEdge& e : _flow_network.incidentEdges(s)) {
+        const NodeID target = e.target;
+        if (!_flow_network.isSource(target) && _flow_network.residualCapacity(e)) {
+          const Flow initial_push = std::min(initial_infinity, _flow_network.residualCapacity(e));
+          _flow_network.increaseFlow(e, initial_push);
+          ++_num_augmentations;
+          if (_flow_network.isSink(target)) {
+            _added_excess[target] += initial_push;
+          } else {
+            _excess[target] += initial_push;
+          }
+        }
+      }
+    }
+  }
+
+  // Sets the distance label of each node to its distance to the sinks in the
+  // residual graph. Nodes that cannot reach a sink get n plus their distance to
+  // the sources. Afterwards, the active nodes are all non-terminal nodes with excess.
+  void globalRelabeling() {
+    const NodeID* nodes = _flow_network.nodes().first;
+    const NodeID unreachable = 2 * _num_nodes;
+    parallelFor(_num_nodes, [&](const size_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          _distance[nodes[i]] = unreachable;
+          _discovered[nodes[i]] = false;
+        }
+      });
+
+    for (const NodeID& s : _flow_network.sources()) {
+      _distance[s] = _num_nodes;
+      _discovered[s] = true;
+    }
+    _active.clear();
+    for (const NodeID& t : _flow_network.sinks()) {
+      _distance[t] = 0;
+      _discovered[t] = true;
+      _active.push_back(t);
+    }
+    reverseBFS(_active, 0);
+
+    for (const NodeID& s : _flow_network.sources()) {
+      _active.push_back(s);
+    }
+    reverseBFS(_active, _num_nodes);
+
+    parallelFor(_num_nodes, [&](const size_t thread, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          const NodeID node = nodes[i];
+          if (_excess[node] > 0 && !isTerminal(node)) {
+            ASSERT(_distance[node] < unreachable, "Node " << node << " has excess but no path to a source!");
+            _thread_local_nodes[thread].push_back(node);
+          }
+        }
+      });
+    collectThreadLocalNodes(_active);
+    _work = 0;
+  }
+
+  // Level-synchronous BFS on the reverse residual graph starting from frontier,
+  // whose nodes have distance label distance.
+  void reverseBFS(std::vector<NodeID>& frontier, NodeID distance) {
+    while (!frontier.empty()) {
+      ++distance;
+      parallelFor(frontier.size(), [&](const size_t thread, const size_t begin, const size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            for (const FlowEdge& e : _flow_network.incidentEdges(frontier[i])) {
+              const NodeID u = e.target;
+              if (!_discovered[u] && _flow_network.residualCapacity(_flow_network.reverseEdge(e)) &&
+                  !_discovered[u].exchange(true)) {
+                _distance[u] = distance;
+                _thread_local_nodes[thread].push_back(u);
+              }
+            }
+          }
+        });
+      collectThreadLocalNodes(frontier);
+    }
+  }
+
+  void discharge() {
+    std::atomic<size_t> num_pushes(0);
+    std::atomic<size_t> work(0);
+
+    // Push excess over admissible edges
+    parallelFor(_active.size(), [&](const size_t thread, const size_t begin, const size_t end) {
+        size_t local_num_pushes = 0;
+        for (size_t i = begin; i < end; ++i) {
+          const NodeID u = _active[i];
+          const NodeID distance_u = _distance[u];
+          Flow excess = _excess[u];
+          for (FlowEdge& e : _flow_network.incidentEdges(u)) {
+            if (excess == 0) {
+              break;
+            }
+            const NodeID v = e.target;
+            if (_distance[v] + 1 == distance_u && _flow_network.residualCapacity(e)) {
+              const Flow delta = std::min(excess, _flow_network.residualCapacity(e));
+              _flow_network.increaseFlow(e, delta);
+              _added_excess[v] += delta;
+              excess -= delta;
+              ++local_num_pushes;
+              if (!isTerminal(v) && !_in_next_round[v].exchange(true)) {
+                _thread_local_nodes[thread].push_back(v);
+              }
+            }
+          }
+          _excess[u] = excess;
+          if (excess > 0 && !_in_next_round[u].exchange(true)) {
+            _thread_local_nodes[thread].push_back(u);
+          }
+        }
+        num_pushes += local_num_pushes;
+      });
+    collectThreadLocalNodes(_next_active);
+
+    // Relabel all nodes which could not push out their excess. The new distance
+    // labels are based on the distance labels of the previous round.
+    parallelFor(_active.size(), [&](const size_t, const size_t begin, const size_t end) {
+        size_t local_work = 0;
+        for (size_t i = begin; i < end; ++i) {
+          const NodeID u = _active[i];
+          if (_excess[u] > 0) {
+            NodeID new_distance = 2 * _num_nodes;
+            for (const FlowEdge& e : _flow_network.incidentEdges(u)) {
+              if (_flow_network.residualCapacity(e)) {
+                new_distance = std::min(new_distance, _distance[e.target] + 1);
+              }
+              ++local_work;
+            }
+            ASSERT(new_distance > _distance[u], "Node " << u << " is relabeled although it has an admissible edge!");
+            _new_distance[u] = new_distance;
+          }
+        }
+        work += local_work;
+      });
+
+    parallelFor(_next_active.size(), [&](const size_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          const NodeID u = _next_active[i];
+          if (_excess[u] > 0) {
+            _distance[u] = _new_distance[u];
+          }
+          _excess[u] += _added_excess[u].exchange(0);
+          _in_next_round[u] = false;
+        }
+      });
+
+    _active.swap(_next_active);
+    _num_augmentations += num_pushes;
+    _work += work + _active.size();
+  }
+
+  using Base::_hg;
+  using Base::_context;
+  using Base::_flow_network;
+  using Base::_num_augmentations;
+
+  std::unique_ptr<ThreadPool> _pool;
+  size_t _num_nodes;
+  std::vector<Flow> _excess;
+  // Excess received in the current round (for sinks: in total)
+  std::vector<std::atomic<Flow> > _added_excess;
+  std::vector<NodeID> _distance;
+  std::vector<NodeID> _new_distance;
+  std::vector<std::atomic<bool> > _in_next_round;
+  std::vector<std::atomic<bool> > _discovered;
+  std::vector<NodeID> _active;
+  std::vector<NodeID> _next_active;
+  std::vector<std::vector<NodeID> > _thread_local_nodes;
+  size_t _work;
+};
+
 template <class Network = Mandatory>
 class BoykovKolmogorov : public MaximumFlow<Network>{
   using Base = MaximumFlow<Network>;
@@ -537,7 +863,7 @@ class BoykovKolmogorov : public MaximumFlow<Network>{
 
     FlowGraph::arc* a = _flow_graph.get_first_arc();
     while (a != _flow_graph.arc_last) {
-      const Flow flow = a->flowEdge->capacity - _flow_graph.get_rcap(a);
+      const Flow flow = a->flowEdge->capacity - a->flowEdge->flow - _flow_graph.get_rcap(a);
       if (flow != 0) {
         a->flowEdge->increaseFlow(flow);
       }
@@ -574,9 +900,9 @@ class BoykovKolmogorov : public MaximumFlow<Network>{
       const NodeID u = _flow_network_mapping[node];
       for (FlowEdge& edge : _flow_network.incidentEdges(node)) {
         const NodeID v = _flow_network_mapping[edge.target];
-        const Capacity c = edge.capacity;
+        const Capacity c = _flow_network.residualCapacity(edge);
         FlowEdge& rev_edge = _flow_network.reverseEdge(edge);
-        const Capacity rev_c = rev_edge.capacity;
+        const Capacity rev_c = _flow_network.residualCapacity(rev_edge);
         if (!_visited[edge.target]) {
           FlowGraph::arc* a = _flow_graph.add_edge(u, v, c, rev_c);
           a->flowEdge = &edge;
@@ -625,7 +951,7 @@ class IBFS : public MaximumFlow<Network>{
 
     FlowGraph::Arc* a = _flow_graph.arcs;
     while (a != _flow_graph.arcEnd) {
-      const Flow flow = a->flowEdge->capacity - a->rCap;
+      const Flow flow = a->flowEdge->capacity - a->flowEdge->flow - a->rCap;
       if (flow != 0) {
         a->flowEdge->increaseFlow(flow);
       }
@@ -660,9 +986,9 @@ class IBFS : public MaximumFlow<Network>{
       const NodeID u = _flow_network_mapping[node];
       for (FlowEdge& edge : _flow_network.incidentEdges(node)) {
         const NodeID v = _flow_network_mapping[edge.target];
-        const Capacity c = edge.capacity;
+        const Capacity c = _flow_network.residualCapacity(edge);
         FlowEdge& rev_edge = _flow_network.reverseEdge(edge);
-        const Capacity rev_c = rev_edge.capacity;
+        const Capacity rev_c = _flow_network.residualCapacity(rev_edge);
         if (!_visited[edge.target]) {
           _flow_graph.addEdge(u, v, c, rev_c, &edge, &rev_edge);
         }
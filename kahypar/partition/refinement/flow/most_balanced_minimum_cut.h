@@ -23,7 +23,9 @@
 
 #include <algorithm>
 #include <array>
+#include <memory>
 #include <queue>
+#include <random>
 #include <stack>
 #include <string>
 #include <utility>
@@ -38,6 +40,8 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/flow/strongly_connected_components.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/thread_pool.h"
 
 namespace kahypar {
 using ds::Graph;
@@ -45,6 +49,28 @@ using ds::Edge;
 
 template <class Network = Mandatory>
 class MostBalancedMinimumCut {
+  // Result of a sweep through a random topological order of the SCC DAG
+  struct Sweep {
+    double imbalance;
+    // The index of the sweep determines its random topological order
+    size_t index;
+    // The first num_moved SCCs of the topological order are moved to block_1
+    size_t num_moved;
+  };
+
+  struct SweepBuffers {
+    SweepBuffers() :
+      in_degree(),
+      topological_order(),
+      part_weight() { }
+
+    std::vector<NodeID> in_degree;
+    std::vector<NodeID> topological_order;
+    std::vector<HypernodeWeight> part_weight;
+  };
+
+  static constexpr NodeID kMinNumSCCsForParallelSweeps = 1024;
+
  public:
   MostBalancedMinimumCut(Hypergraph& hypergraph,
                          const Context& context,
@@ -55,9 +81,28 @@ class MostBalancedMinimumCut {
     _visited(_hg.initialNumNodes() + 2 * _hg.initialNumEdges()),
     _graph_to_flow_network(flowNetwork.initialSize(), Network::kInvalidNode),
     _flow_network_to_graph(flowNetwork.initialSize(), Network::kInvalidNode),
-    _scc_node_weight(flowNetwork.initialSize(), 0),
     _Q(),
-    _sccs(flowNetwork.initialSize()) { }
+    _sccs(flowNetwork.initialSize()),
+    _edge_sources(),
+    _edge_targets(),
+    _first_edge(),
+    _targets(),
+    _scc(),
+    _scc_first_node(),
+    _scc_nodes(),
+    _scc_node_weight(),
+    _dag_first_edge(),
+    _dag_targets(),
+    _dag_in_degree(),
+    _last_dag_edge_source(),
+    _initial_part_weight(),
+    _sweep_buffers(),
+    _pool() {
+    if (_context.partition.num_threads > 1) {
+      _pool = std::make_unique<ThreadPool>(_context.partition.num_threads);
+    }
+    _sweep_buffers.resize(_pool ? _pool->numThreads() : 1);
+  }
 
   MostBalancedMinimumCut(const MostBalancedMinimumCut&) = delete;
   MostBalancedMinimumCut(MostBalancedMinimumCut&&) = delete;
@@ -79,90 +124,73 @@ class MostBalancedMinimumCut {
     markAllReachableNodesAsVisited<false>(block_0, block_1);
 
     // Build residual graph
-    Graph residual_graph(std::move(buildResidualGraph()));
+    const NodeID num_nodes = buildResidualGraph();
 
     // Find strongly connected components
-    findStronglyConnectedComponents(residual_graph);
+    const NodeID num_sccs = static_cast<NodeID>(_sccs.compute(num_nodes, _first_edge, _targets, _scc));
 
     // Contract strongly connected components
-    auto contraction = residual_graph.contractClusters();
-    Graph dag(std::move(contraction.first));
-    std::vector<NodeID> contraction_mapping = std::move(contraction.second);
-
-    // Build mapping from contracted graph to flow network
-    std::vector<std::vector<NodeID> > scc_to_flow_network(dag.numNodes(), std::vector<NodeID>());
-    for (const NodeID& u : residual_graph.nodes()) {
-      const NodeID flow_u = _graph_to_flow_network.get(u);
-      if (_flow_network.isHypernode(flow_u)) {
-        scc_to_flow_network[contraction_mapping[u]].push_back(flow_u);
-        _scc_node_weight.update(contraction_mapping[u], _hg.nodeWeight(flow_u));
-      }
-    }
+    buildDAG(num_nodes, num_sccs);
 
-    // Calculate in degrees of nodes in DAG graph for topological ordering
-    std::vector<size_t> in_degree(dag.numNodes(), 0);
-    for (const NodeID& u : dag.nodes()) {
-      for (const Edge& e : dag.incidentEdges(u)) {
-        const NodeID v = e.target_node;
-        if (u != v) {
-          in_degree[v]++;
-        }
-      }
+    for (PartitionID part = 0; part < _context.partition.k; ++part) {
+      _initial_part_weight[part] = _hg.partWeight(part);
     }
 
-    // Find most balanced minimum cut
-    std::vector<NodeID> topological_order(dag.numNodes(), 0);
-    std::vector<PartitionID> best_partition_id(dag.numNodes(), block_0);
-    double best_imbalance = metrics::imbalance(_hg, _context);
-
     DBG << "Start Most Balanced Minimum Cut (Bipartition = {" << block_0 << "," << block_1 << "}";
     DBG << "Initial imbalance: " << V(metrics::imbalance(_hg, _context));
 
-    for (size_t i = 0; i < 20; ++i) {
-      // Compute random topological order
-      topologicalSort(dag, in_degree, topological_order);
-
-      // Sweep through topological order and find best imbalance
-      std::vector<PartitionID> tmp_partition_id(dag.numNodes(), block_0);
-      double tmp_best_imbalance = metrics::imbalance(_hg, _context);
-
-      std::vector<HypernodeWeight> part_weight(_context.partition.k, 0);
-      for (PartitionID part = 0; part < _context.partition.k; ++part) {
-        part_weight[part] = _hg.partWeight(part);
+    // Find most balanced minimum cut. Sweep 0 denotes the initial partition, which
+    // is kept if no sweep improves the imbalance.
+    const int seed = Randomize::instance().newRandomSeed();
+    const size_t num_sweeps = _context.local_search.flow.most_balanced_minimum_cut_sweeps;
+    Sweep best_sweep { metrics::imbalance(_hg, _context), 0, 0 };
+    if (_pool && num_sweeps > 1 && num_sccs >= kMinNumSCCsForParallelSweeps) {
+      const size_t num_threads = _pool->numThreads();
+      std::vector<Sweep> best_sweep_of_thread(num_threads, best_sweep);
+      for (size_t thread = 0; thread < num_threads; ++thread) {
+        _pool->enqueue([&, thread]() {
+            for (size_t i = thread + 1; i <= num_sweeps; i += num_threads) {
+              const Sweep result = sweep(i, seed, num_sccs, block_0, block_1, _sweep_buffers[thread]);
+              if (isBetter(result, best_sweep_of_thread[thread])) {
+                best_sweep_of_thread[thread] = result;
+              }
+            }
+          });
       }
-      for (size_t idx = 0; idx < topological_order.size(); ++idx) {
-        const NodeID u = topological_order[idx];
-        tmp_partition_id[u] = block_1;
-        part_weight[block_0] -= _scc_node_weight.get(u);
-        part_weight[block_1] += _scc_node_weight.get(u);
-        double cur_imbalance = imbalance<true>(part_weight);
-        if (_context.partition.k > 2) {
-          cur_imbalance = imbalance<false>(part_weight);
+      _pool->waitForAll();
+      for (const Sweep& result : best_sweep_of_thread) {
+        if (isBetter(result, best_sweep)) {
+          best_sweep = result;
         }
-
-        if (cur_imbalance > tmp_best_imbalance) {
-          tmp_partition_id[u] = block_0;
-          break;
+      }
+    } else {
+      for (size_t i = 1; i <= num_sweeps; ++i) {
+        const Sweep result = sweep(i, seed, num_sccs, block_0, block_1, _sweep_buffers[0]);
+        if (isBetter(result, best_sweep)) {
+          best_sweep = result;
         }
-        tmp_best_imbalance = cur_imbalance;
       }
+    }
 
-      if (tmp_best_imbalance < best_imbalance) {
-        best_imbalance = tmp_best_imbalance;
-        best_partition_id = tmp_partition_id;
+    DBG << "Best imbalance: " << best_sweep.imbalance;
+
+    // The topological order of the best sweep determines the SCCs moved to block_1
+    std::vector<PartitionID> best_partition_id(num_sccs, block_0);
+    std::vector<NodeID>& topological_order = _sweep_buffers[0].topological_order;
+    if (best_sweep.num_moved > 0) {
+      topologicalSort(best_sweep.index, seed, num_sccs, _sweep_buffers[0]);
+      for (size_t idx = 0; idx < best_sweep.num_moved; ++idx) {
+        best_partition_id[topological_order[idx]] = block_1;
       }
     }
 
-    DBG << "Best imbalance: " << best_imbalance;
-
     ASSERT([&]() {
         const HyperedgeWeight metric_before = metrics::objective(_hg, _context.partition.objective);
         const double imbalance_before = metrics::imbalance(_hg, _context);
-        std::vector<NodeID> topological_order(dag.numNodes(), 0);
-        std::vector<NodeID> part_before(dag.numNodes(), block_0);
-        topologicalSort(dag, in_degree, topological_order);
+        std::vector<NodeID> part_before(num_sccs, block_0);
+        topologicalSort(1, seed, num_sccs, _sweep_buffers[0]);
         for (const NodeID& u : topological_order) {
-          for (const NodeID& v : scc_to_flow_network[u]) {
+          for (const NodeID& v : sccHypernodes(u)) {
             const PartitionID from = _hg.partID(v);
             const PartitionID to = best_partition_id[u];
             if (from != to) {
@@ -181,8 +209,8 @@ class MostBalancedMinimumCut {
         }
 
         // Rollback hypernode assignment
-        for (const NodeID& u : dag.nodes()) {
-          for (const NodeID& v : scc_to_flow_network[u]) {
+        for (NodeID u = 0; u < num_sccs; ++u) {
+          for (const NodeID& v : sccHypernodes(u)) {
             const PartitionID from = _hg.partID(v);
             const PartitionID to = part_before[u];
             if (from != to) {
@@ -204,8 +232,8 @@ class MostBalancedMinimumCut {
       } (), "Most balanced minimum cut failed!");
 
     // Assign most balanced minimum cut
-    for (const NodeID& u : dag.nodes()) {
-      for (const NodeID& v : scc_to_flow_network[u]) {
+    for (NodeID u = 0; u < num_sccs; ++u) {
+      for (const NodeID& v : sccHypernodes(u)) {
         const PartitionID from = _hg.partID(v);
         const PartitionID to = best_partition_id[u];
         if (from != to) {
@@ -214,21 +242,94 @@ class MostBalancedMinimumCut {
       }
     }
 
-    ASSERT(best_imbalance == metrics::imbalance(_hg, _context),
+    ASSERT(best_sweep.imbalance == metrics::imbalance(_hg, _context),
            "Best imbalance didn't match with current imbalance"
-           << V(best_imbalance) << V(metrics::imbalance(_hg, _context)));
+           << V(best_sweep.imbalance) << V(metrics::imbalance(_hg, _context)));
   }
 
  private:
   static constexpr bool debug = false;
 
+  // Iterates over the hypernodes contained in an SCC
+  class SCCHypernodeIterator {
+   public:
+    SCCHypernodeIterator(const MostBalancedMinimumCut& mbmc, const NodeID* pos, const NodeID* end) :
+      _mbmc(mbmc),
+      _pos(pos),
+      _end(end) {
+      skipNonHypernodes();
+    }
+
+    NodeID operator* () const {
+      return _mbmc._graph_to_flow_network.get(*_pos);
+    }
+
+    SCCHypernodeIterator& operator++ () {
+      ++_pos;
+      skipNonHypernodes();
+      return *this;
+    }
+
+    bool operator!= (const SCCHypernodeIterator& other) const {
+      return _pos != other._pos;
+    }
+
+   private:
+    void skipNonHypernodes() {
+      while (_pos != _end && !_mbmc._flow_network.isHypernode(_mbmc._graph_to_flow_network.get(*_pos))) {
+        ++_pos;
+      }
+    }
+
+    const MostBalancedMinimumCut& _mbmc;
+    const NodeID* _pos;
+    const NodeID* _end;
+  };
+
+  std::pair<SCCHypernodeIterator, SCCHypernodeIterator> sccHypernodes(const NodeID scc) const {
+    const NodeID* begin = _scc_nodes.data() + _scc_first_node[scc];
+    const NodeID* end = _scc_nodes.data() + _scc_first_node[scc + 1];
+    return std::make_pair(SCCHypernodeIterator(*this, begin, end),
+                          SCCHypernodeIterator(*this, end, end));
+  }
+
+  static bool isBetter(const Sweep& sweep, const Sweep& other) {
+    return sweep.imbalance < other.imbalance ||
+           (sweep.imbalance == other.imbalance && sweep.index < other.index);
+  }
+
   void reset() {
     _visited.reset();
     _graph_to_flow_network.resetUsedEntries();
     _flow_network_to_graph.resetUsedEntries();
-    _scc_node_weight.resetUsedEntries();
+    _initial_part_weight.resize(_context.partition.k);
+  }
+
+  // Moves the SCCs in a random topological order to block_1 as long as
+  // the imbalance does not increase.
+  Sweep sweep(const size_t index, const int seed, const NodeID num_sccs,
+              const PartitionID block_0, const PartitionID block_1, SweepBuffers& buffers) {
+    topologicalSort(index, seed, num_sccs, buffers);
+
+    Sweep result { sweepImbalance(_initial_part_weight), index, 0 };
+    std::vector<HypernodeWeight>& part_weight = buffers.part_weight;
+    part_weight = _initial_part_weight;
+    for (const NodeID& u : buffers.topological_order) {
+      part_weight[block_0] -= _scc_node_weight[u];
+      part_weight[block_1] += _scc_node_weight[u];
+      const double cur_imbalance = sweepImbalance(part_weight);
+      if (cur_imbalance > result.imbalance) {
+        break;
+      }
+      result.imbalance = cur_imbalance;
+      ++result.num_moved;
+    }
+    return result;
   }
 
+  double sweepImbalance(const std::vector<HypernodeWeight>& part_weight) {
+    return _context.partition.k > 2 ? imbalance<false>(part_weight) : imbalance<true>(part_weight);
+  }
 
   /**
    * Executes a BFS starting from the source (sourceSet = true)
@@ -288,8 +389,10 @@ class MostBalancedMinimumCut {
     }
   }
 
-  Graph buildResidualGraph() {
-    size_t cur_graph_node = 0;
+  // Builds the adjacency array of the residual graph induced by all nodes
+  // not reachable from the source or sink set. Returns its number of nodes.
+  NodeID buildResidualGraph() {
+    NodeID cur_graph_node = 0;
     for (const NodeID& node : _flow_network.nodes()) {
       if (!_visited[node]) {
         _graph_to_flow_network.set(cur_graph_node, node);
@@ -304,18 +407,16 @@ class MostBalancedMinimumCut {
       }
     }
 
-    std::vector<std::vector<Edge> > adj_list(cur_graph_node, std::vector<Edge>());
-
+    _edge_sources.clear();
+    _edge_targets.clear();
     for (const NodeID& node : _flow_network.nodes()) {
       if (!_visited[node]) {
         const NodeID source = _flow_network_to_graph.get(node);
         for (FlowEdge& flow_edge : _flow_network.incidentEdges(node)) {
           const NodeID target = flow_edge.target;
           if (_flow_network.residualCapacity(flow_edge) && !_visited[target]) {
-            Edge e;
-            e.target_node = _flow_network_to_graph.get(target);
-            e.weight = 1.0;
-            adj_list[source].push_back(e);
+            _edge_sources.push_back(source);
+            _edge_targets.push_back(_flow_network_to_graph.get(target));
           }
         }
       }
@@ -328,69 +429,109 @@ class MostBalancedMinimumCut {
           const NodeID in_he = _flow_network_to_graph.get(_flow_network.mapToIncommingHyperedgeID(he));
           const NodeID out_he = _flow_network_to_graph.get(_flow_network.mapToOutgoingHyperedgeID(he));
           if (in_he != Network::kInvalidNode) {
-            Edge e;
-            e.target_node = in_he;
-            e.weight = 1.0;
-            adj_list[hn_node].push_back(e);
+            _edge_sources.push_back(hn_node);
+            _edge_targets.push_back(in_he);
           }
           if (out_he != Network::kInvalidNode) {
-            Edge e;
-            e.target_node = hn_node;
-            e.weight = 1.0;
-            adj_list[out_he].push_back(e);
+            _edge_sources.push_back(out_he);
+            _edge_targets.push_back(hn_node);
           }
         }
       }
     }
 
-    std::vector<NodeID> adj_array(1, 0);
-    std::vector<Edge> edges;
+    // Counting sort of the edges by their source
+    _first_edge.assign(cur_graph_node + 1, 0);
+    for (const NodeID& source : _edge_sources) {
+      ++_first_edge[source + 1];
+    }
     for (NodeID u = 0; u < cur_graph_node; ++u) {
-      for (const Edge& e : adj_list[u]) {
-        edges.push_back(e);
-      }
-      adj_array.push_back(adj_array[u] + adj_list[u].size());
+      _first_edge[u + 1] += _first_edge[u];
+    }
+    _targets.resize(_edge_targets.size());
+    for (size_t i = 0; i < _edge_sources.size(); ++i) {
+      _targets[_first_edge[_edge_sources[i]]++] = _edge_targets[i];
     }
+    for (NodeID u = cur_graph_node; u > 0; --u) {
+      _first_edge[u] = _first_edge[u - 1];
+    }
+    _first_edge[0] = 0;
 
-    return Graph(adj_array, edges);
+    return cur_graph_node;
   }
 
-  void findStronglyConnectedComponents(Graph& g) {
-    _sccs.compute(g);
+  // Contracts the SCCs of the residual graph into a DAG without parallel edges
+  // and computes the in-degree and the hypernode weight of each SCC.
+  void buildDAG(const NodeID num_nodes, const NodeID num_sccs) {
+    _scc_first_node.assign(num_sccs + 1, 0);
+    for (NodeID u = 0; u < num_nodes; ++u) {
+      ++_scc_first_node[_scc[u] + 1];
+    }
+    for (NodeID scc = 0; scc < num_sccs; ++scc) {
+      _scc_first_node[scc + 1] += _scc_first_node[scc];
+    }
+    _scc_nodes.resize(num_nodes);
+    for (NodeID u = 0; u < num_nodes; ++u) {
+      _scc_nodes[_scc_first_node[_scc[u]]++] = u;
+    }
+    for (NodeID scc = num_sccs; scc > 0; --scc) {
+      _scc_first_node[scc] = _scc_first_node[scc - 1];
+    }
+    _scc_first_node[0] = 0;
+
+    _scc_node_weight.assign(num_sccs, 0);
+    _dag_first_edge.assign(num_sccs + 1, 0);
+    _dag_targets.clear();
+    _dag_in_degree.assign(num_sccs, 0);
+    _last_dag_edge_source.assign(num_sccs, num_sccs);
+    for (NodeID scc = 0; scc < num_sccs; ++scc) {
+      for (const NodeID& v : sccHypernodes(scc)) {
+        _scc_node_weight[scc] += _hg.nodeWeight(v);
+      }
+      for (NodeID i = _scc_first_node[scc]; i < _scc_first_node[scc + 1]; ++i) {
+        const NodeID u = _scc_nodes[i];
+        for (NodeID e = _first_edge[u]; e < _first_edge[u + 1]; ++e) {
+          const NodeID target_scc = _scc[_targets[e]];
+          if (target_scc != scc && _last_dag_edge_source[target_scc] != scc) {
+            _last_dag_edge_source[target_scc] = scc;
+            _dag_targets.push_back(target_scc);
+            ++_dag_in_degree[target_scc];
+          }
+        }
+      }
+      _dag_first_edge[scc + 1] = _dag_targets.size();
+    }
   }
 
-
-  void topologicalSort(const Graph& g,
-                       std::vector<size_t> in_degree,
-                       std::vector<NodeID>& topological_order) {
-    std::vector<NodeID> start_nodes;
-    for (const NodeID& u : g.nodes()) {
+  // Computes the random topological order of the SCC DAG used by the given sweep.
+  // The order only depends on the seed and the index of the sweep.
+  void topologicalSort(const size_t index, const int seed, const NodeID num_sccs,
+                       SweepBuffers& buffers) {
+    std::vector<NodeID>& in_degree = buffers.in_degree;
+    std::vector<NodeID>& topological_order = buffers.topological_order;
+    in_degree = _dag_in_degree;
+    topological_order.clear();
+    for (NodeID u = 0; u < num_sccs; ++u) {
       if (in_degree[u] == 0) {
-        start_nodes.push_back(u);
+        topological_order.push_back(u);
       }
     }
-    std::random_shuffle(start_nodes.begin(), start_nodes.end());
-    for (const NodeID& u : start_nodes) {
-      _Q.push(u);
-    }
-
-    size_t idx = 0;
-    while (!_Q.empty()) {
-      const NodeID u = _Q.front();
-      _Q.pop();
-      topological_order[idx++] = u;
-      for (const Edge& e : g.incidentEdges(u)) {
-        const NodeID v = e.target_node;
-        if (u != v) {
-          in_degree[v]--;
-          if (in_degree[v] == 0) {
-            _Q.push(v);
-          }
+    std::mt19937 gen(Randomize::deriveSeed(seed, index));
+    std::shuffle(topological_order.begin(), topological_order.end(), gen);
+
+    // The topological order itself serves as BFS queue
+    for (size_t idx = 0; idx < topological_order.size(); ++idx) {
+      const NodeID u = topological_order[idx];
+      for (NodeID e = _dag_first_edge[u]; e < _dag_first_edge[u + 1]; ++e) {
+        const NodeID v = _dag_targets[e];
+        if (--in_degree[v] == 0) {
+          topological_order.push_back(v);
         }
       }
     }
 
-    ASSERT(idx == g.numNodes(), "Topological sort failed!" << V(idx) << V(g.numNodes()));
+    ASSERT(topological_order.size() == num_sccs,
+           "Topological sort failed!" << V(topological_order.size()) << V(num_sccs));
   }
 
 
@@ -425,9 +566,30 @@ class MostBalancedMinimumCut {
   FastResetFlagArray<> _visited;
   FastResetArray<NodeID> _graph_to_flow_network;
   FastResetArray<NodeID> _flow_network_to_graph;
-  FastResetArray<HypernodeWeight> _scc_node_weight;
 
   std::queue<NodeID> _Q;  // BFS queue
   StronglyConnectedComponents _sccs;
+
+  // Residual graph (adjacency array)
+  std::vector<NodeID> _edge_sources;
+  std::vector<NodeID> _edge_targets;
+  std::vector<NodeID> _first_edge;
+  std::vector<NodeID> _targets;
+
+  // SCCs of the residual graph
+  std::vector<ClusterID> _scc;
+  std::vector<NodeID> _scc_first_node;
+  std::vector<NodeID> _scc_nodes;
+  std::vector<HypernodeWeight> _scc_node_weight;
+
+  // DAG of the SCCs (adjacency array)
+  std::vector<NodeID> _dag_first_edge;
+  std::vector<NodeID> _dag_targets;
+  std::vector<NodeID> _dag_in_degree;
+  std::vector<NodeID> _last_dag_edge_source;
+
+  std::vector<HypernodeWeight> _initial_part_weight;
+  std::vector<SweepBuffers> _sweep_buffers;
+  std::unique_ptr<ThreadPool> _pool;
 };
 }  // namespace kahypar
@@ -30,6 +30,7 @@
 #include "kahypar/meta/policy_registry.h"
 #include "kahypar/meta/typelist.h"
 #include "kahypar/partition/context.h"
+#include "kahypar/utils/randomize.h"
 
 namespace kahypar {
 class FlowRegionBuildPolicy : public meta::PolicyBase {
@@ -42,7 +43,7 @@ class FlowRegionBuildPolicy : public meta::PolicyBase {
                                 const HypernodeWeight max_part_weight,
                                 FastResetFlagArray<>& visited) {
     visited.reset();
-    std::random_shuffle(start_nodes.begin(), start_nodes.end());
+    Randomize::instance().shuffleVector(start_nodes, start_nodes.size());
     std::queue<HypernodeID> Q;
     HypernodeWeight queue_weight = 0;
     for (const HypernodeID& hn : start_nodes) {
@@ -23,18 +23,25 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
-#include "kahypar/datastructure/fast_reset_flag_array.h"
 #include "kahypar/datastructure/sparse_set.h"
 #include "kahypar/definitions.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
+#include "kahypar/utils/randomize.h"
 
 namespace kahypar {
+// Maintains the quotient graph of a k-way partition, i.e., the adjacent block pairs and
+// the cut hyperedges of each adjacent block pair. Only block pairs that actually share a
+// cut hyperedge are stored (in a hash-based index), which keeps the memory consumption
+// proportional to the size of the quotient graph even for large k. The cut hyperedges of
+// a block pair are updated incrementally in changeNodePart.
 class QuotientGraphBlockScheduler {
   typedef std::pair<PartitionID, PartitionID> edge;
   using ConstIncidenceIterator = std::vector<edge>::const_iterator;
@@ -45,10 +52,10 @@ class QuotientGraphBlockScheduler {
     _hg(hypergraph),
     _context(context),
     _quotient_graph(),
-    _block_pair_cut_he(context.partition.k,
-                       std::vector<std::vector<HyperedgeID> >(context.partition.k,
-                                                              std::vector<HyperedgeID>())),
-    _visited(_hg.initialNumEdges()) { }
+    _block_pair_index(),
+    _block_pair_cut_he(),
+    _cut_he_position(),
+    _no_cut_hyperedges() { }
 
   QuotientGraphBlockScheduler(const QuotientGraphBlockScheduler&) = delete;
   QuotientGraphBlockScheduler(QuotientGraphBlockScheduler&&) = delete;
@@ -56,26 +63,27 @@ class QuotientGraphBlockScheduler {
   QuotientGraphBlockScheduler& operator= (QuotientGraphBlockScheduler&&) = delete;
 
   void buildQuotientGraph() {
-    std::set<edge> edge_list;
     for (const HyperedgeID& he : _hg.edges()) {
       if (_hg.connectivity(he) > 1) {
         for (const PartitionID& block0 : _hg.connectivitySet(he)) {
           for (const PartitionID& block1 : _hg.connectivitySet(he)) {
             if (block0 < block1) {
-              edge_list.insert(std::make_pair(block0, block1));
-              _block_pair_cut_he[block0][block1].push_back(he);
+              addCutHyperedge(block0, block1, he);
             }
           }
         }
       }
     }
-    for (const edge& e : edge_list) {
-      _quotient_graph.push_back(e);
+    _quotient_graph.clear();
+    for (const auto& block_pair : _block_pair_index) {
+      _quotient_graph.push_back(std::make_pair(block_pair.first / _context.partition.k,
+                                               block_pair.first % _context.partition.k));
     }
+    std::sort(_quotient_graph.begin(), _quotient_graph.end());
   }
 
   void randomShuffleQoutientEdges() {
-    std::random_shuffle(_quotient_graph.begin(), _quotient_graph.end());
+    Randomize::instance().shuffleVector(_quotient_graph, _quotient_graph.size());
   }
 
   std::pair<ConstIncidenceIterator, ConstIncidenceIterator> qoutientGraphEdges() const {
@@ -84,11 +92,12 @@ class QuotientGraphBlockScheduler {
 
   std::pair<ConstCutHyperedgeIterator, ConstCutHyperedgeIterator> blockPairCutHyperedges(const PartitionID block0, const PartitionID block1) {
     ASSERT(block0 < block1, V(block0) << " < " << V(block1));
-    updateBlockPairCutHyperedges(block0, block1);
 
     ASSERT([&]() {
         std::set<HyperedgeID> cut_hyperedges;
-        for (const HyperedgeID& he : _block_pair_cut_he[block0][block1]) {
+        const auto pair = _block_pair_index.find(blockPairKey(block0, block1));
+        for (const HyperedgeID& he : pair == _block_pair_index.end() ?
+             _no_cut_hyperedges : _block_pair_cut_he[pair->second]) {
           if (cut_hyperedges.find(he) != cut_hyperedges.end()) {
             LOG << "Hyperedge " << he << " is contained more than once!";
             return false;
@@ -118,21 +127,26 @@ class QuotientGraphBlockScheduler {
         return true;
       } (), "Cut hyperedge set between " << V(block0) << " and " << V(block1) << " is wrong!");
 
-    return std::make_pair(_block_pair_cut_he[block0][block1].cbegin(),
-                          _block_pair_cut_he[block0][block1].cend());
+    const auto pair = _block_pair_index.find(blockPairKey(block0, block1));
+    if (pair == _block_pair_index.end()) {
+      return std::make_pair(_no_cut_hyperedges.cbegin(), _no_cut_hyperedges.cend());
+    }
+    return std::make_pair(_block_pair_cut_he[pair->second].cbegin(),
+                          _block_pair_cut_he[pair->second].cend());
   }
 
   void changeNodePart(const HypernodeID hn, const PartitionID from, const PartitionID to) {
     if (from != to) {
       _hg.changeNodePart(hn, from, to);
       for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
-        if (_hg.pinCountInPart(he, to) == 1) {
-          for (const PartitionID& part : _hg.connectivitySet(he)) {
-            if (to < part) {
-              _block_pair_cut_he[to][part].push_back(he);
-            } else if (to > part) {
-              _block_pair_cut_he[part][to].push_back(he);
-            }
+        const bool left_from = _hg.pinCountInPart(he, from) == 0;
+        const bool entered_to = _hg.pinCountInPart(he, to) == 1;
+        for (const PartitionID& part : _hg.connectivitySet(he)) {
+          if (left_from && !(part == to && entered_to)) {
+            removeCutHyperedge(std::min(from, part), std::max(from, part), he);
+          }
+          if (entered_to && part != to) {
+            addCutHyperedge(std::min(to, part), std::max(to, part), he);
           }
         }
       }
@@ -142,30 +156,52 @@ class QuotientGraphBlockScheduler {
  private:
   static constexpr bool debug = false;
 
-  void updateBlockPairCutHyperedges(const PartitionID block0, const PartitionID block1) {
-    _visited.reset();
-    size_t N = _block_pair_cut_he[block0][block1].size();
-    for (size_t i = 0; i < N; ++i) {
-      const HyperedgeID he = _block_pair_cut_he[block0][block1][i];
-      if (_hg.pinCountInPart(he, block0) == 0 ||
-          _hg.pinCountInPart(he, block1) == 0 ||
-          _visited[he]) {
-        std::swap(_block_pair_cut_he[block0][block1][i],
-                  _block_pair_cut_he[block0][block1][N - 1]);
-        _block_pair_cut_he[block0][block1].pop_back();
-        --i;
-        --N;
-      }
-      _visited.set(he, true);
+  uint64_t blockPairKey(const PartitionID block0, const PartitionID block1) const {
+    return static_cast<uint64_t>(block0) * _context.partition.k + block1;
+  }
+
+  static uint64_t positionKey(const size_t pair, const HyperedgeID he) {
+    return (static_cast<uint64_t>(pair) << 32) | he;
+  }
+
+  void addCutHyperedge(const PartitionID block0, const PartitionID block1, const HyperedgeID he) {
+    ASSERT(block0 < block1, V(block0) << V(block1));
+    const auto pair = _block_pair_index.emplace(blockPairKey(block0, block1),
+                                                _block_pair_cut_he.size());
+    if (pair.second) {
+      _block_pair_cut_he.emplace_back();
     }
+    std::vector<HyperedgeID>& cut_hes = _block_pair_cut_he[pair.first->second];
+    ASSERT(_cut_he_position.find(positionKey(pair.first->second, he)) == _cut_he_position.end(),
+           "HE" << he << "is already a cut hyperedge of" << V(block0) << V(block1));
+    _cut_he_position[positionKey(pair.first->second, he)] = cut_hes.size();
+    cut_hes.push_back(he);
+  }
+
+  void removeCutHyperedge(const PartitionID block0, const PartitionID block1,
+                          const HyperedgeID he) {
+    ASSERT(block0 < block1, V(block0) << V(block1));
+    const size_t pair = _block_pair_index.at(blockPairKey(block0, block1));
+    std::vector<HyperedgeID>& cut_hes = _block_pair_cut_he[pair];
+    const auto position = _cut_he_position.find(positionKey(pair, he));
+    ASSERT(position != _cut_he_position.end(),
+           "HE" << he << "is not a cut hyperedge of" << V(block0) << V(block1));
+    const HyperedgeID last = cut_hes.back();
+    cut_hes[position->second] = last;
+    _cut_he_position[positionKey(pair, last)] = position->second;
+    cut_hes.pop_back();
+    _cut_he_position.erase(positionKey(pair, he));
   }
 
   Hypergraph& _hg;
   const Context& _context;
   std::vector<edge> _quotient_graph;
 
-  // Contains the cut hyperedges for each pair of blocks.
-  std::vector<std::vector<std::vector<HyperedgeID> > > _block_pair_cut_he;
-  ds::FastResetFlagArray<> _visited;
+  // Maps each adjacent block pair to its cut hyperedges in _block_pair_cut_he.
+  std::unordered_map<uint64_t, size_t> _block_pair_index;
+  std::vector<std::vector<HyperedgeID> > _block_pair_cut_he;
+  // Position of each cut hyperedge of a block pair to remove it in constant time.
+  std::unordered_map<uint64_t, size_t> _cut_he_position;
+  const std::vector<HyperedgeID> _no_cut_hyperedges;
 };
 }  // namespace kahypar
@@ -33,64 +33,94 @@ using ds::Edge;
 
 class StronglyConnectedComponents {
  public:
+  static constexpr ClusterID kUnassigned = -1;
+
   explicit StronglyConnectedComponents(size_t max_num_nodes) :
     _dfs_num(max_num_nodes, -1),
     _unfinished(),
     _roots(),
-    _call_stack() {
+    _call_stack(),
+    _first_edge(),
+    _targets(),
+    _component() {
     _unfinished.reserve(max_num_nodes);
     _roots.reserve(max_num_nodes);
   }
 
+  // Stores the SCC of each node as its cluster ID.
   void compute(Graph& graph) {
+    _first_edge.assign(1, 0);
+    _targets.clear();
+    for (const NodeID& u : graph.nodes()) {
+      for (const Edge& e : graph.incidentEdges(u)) {
+        _targets.push_back(e.target_node);
+      }
+      _first_edge.push_back(_targets.size());
+    }
+
+    compute(graph.numNodes(), _first_edge, _targets, _component);
+
+    for (const NodeID& u : graph.nodes()) {
+      graph.setClusterID(u, _component[u]);
+    }
+  }
+
+  // Computes the SCCs of the graph with nodes 0, ..., num_nodes - 1 in which node u
+  // has the edges (u, targets[i]) for first_edge[u] <= i < first_edge[u + 1].
+  // Returns the number of SCCs. An SCC gets its ID when it is completed. Therefore,
+  // each edge between two different SCCs points to the SCC with the smaller ID.
+  ClusterID compute(const NodeID num_nodes, const std::vector<NodeID>& first_edge,
+                    const std::vector<NodeID>& targets, std::vector<ClusterID>& component) {
     ASSERT(_roots.empty());
     ASSERT(_unfinished.empty());
     ASSERT(_call_stack.empty());
-    _call_stack.reserve(graph.numEdges());
+    ASSERT(num_nodes <= _dfs_num.size());
+    ASSERT(first_edge.size() == num_nodes + 1);
 
-    std::fill(_dfs_num.begin(), _dfs_num.end(), -1);
-    for (const NodeID& u : graph.nodes()) {
-      graph.setClusterID(u, -1);
-    }
+    std::fill(_dfs_num.begin(), _dfs_num.begin() + num_nodes, -1);
+    component.assign(num_nodes, static_cast<ClusterID>(kUnassigned));
 
     NodeID dfs_num = 0;
     ClusterID cid = 0;
-    for (const NodeID& u : graph.nodes()) {
+    for (NodeID u = 0; u < num_nodes; ++u) {
       if (_dfs_num[u] == -1) {
-        scc(u, graph, dfs_num, cid);
+        scc(u, first_edge, targets, component, dfs_num, cid);
       }
     }
+    return cid;
   }
 
  private:
   // Cheriyan/Mehlhorn 96, Gabow 2000
-  void scc(const NodeID node, Graph& g, NodeID& dfs_num, ClusterID& cid) {
-    using EdgeIterator = Graph::EdgeIterator;
-
+  // The DFS is simulated with an explicit call stack, which stores the next edge
+  // of each node on the DFS path. Thus, deep residual graphs can not overflow the stack.
+  void scc(const NodeID node, const std::vector<NodeID>& first_edge,
+           const std::vector<NodeID>& targets, std::vector<ClusterID>& component,
+           NodeID& dfs_num, ClusterID& cid) {
     ASSERT(_call_stack.empty());
-    _call_stack.push_back(std::make_pair(node, g.firstEdge(node)));
+    _call_stack.push_back(std::make_pair(node, first_edge[node]));
     _dfs_num[node] = dfs_num++;
     _unfinished.push_back(node);
     _roots.push_back(node);
 
     while (!_call_stack.empty()) {
       const NodeID current_node = _call_stack.back().first;
-      const EdgeIterator current_edge = _call_stack.back().second;
+      const NodeID current_edge = _call_stack.back().second;
       _call_stack.pop_back();
 
-      const EdgeIterator first_invalid_edge = g.firstInvalidEdge(current_node);
-      for (EdgeIterator e = current_edge; e != first_invalid_edge; ++e) {
-        const NodeID target = e->target_node;
+      const NodeID first_invalid_edge = first_edge[current_node + 1];
+      for (NodeID e = current_edge; e != first_invalid_edge; ++e) {
+        const NodeID target = targets[e];
 
         if (_dfs_num[target] == -1) {
           _call_stack.push_back(std::make_pair(current_node, e));
-          _call_stack.push_back(std::make_pair(target, g.firstEdge(target)));
+          _call_stack.push_back(std::make_pair(target, first_edge[target]));
 
           _dfs_num[target] = dfs_num++;
           _unfinished.push_back(target);
           _roots.push_back(target);
           break;
-        } else if (g.clusterID(target) == -1) {
+        } else if (component[target] == kUnassigned) {
           while (_dfs_num[_roots.back()] > _dfs_num[target]) {
             _roots.pop_back();
           }
@@ -102,7 +132,7 @@ class StronglyConnectedComponents {
         do {
           w = _unfinished.back();
           _unfinished.pop_back();
-          g.setClusterID(w, cid);
+          component[w] = cid;
         } while (w != current_node);
         ++cid;
         _roots.pop_back();
@@ -114,6 +144,11 @@ class StronglyConnectedComponents {
   std::vector<int> _dfs_num;
   std::vector<NodeID> _unfinished;
   std::vector<NodeID> _roots;
-  std::vector<std::pair<NodeID, Graph::EdgeIterator> > _call_stack;
+  std::vector<std::pair<NodeID, NodeID> > _call_stack;
+
+  // Adjacency array of the graph passed to compute(Graph&)
+  std::vector<NodeID> _first_edge;
+  std::vector<NodeID> _targets;
+  std::vector<ClusterID> _component;
 };
 }  // namespace kahypar
@@ -23,6 +23,7 @@
 #include <limits>
 #include <vector>
 
+#include "kahypar/datastructure/adaptive_gain_queue.h"
 #include "kahypar/datastructure/bucket_queue.h"
 #include "kahypar/datastructure/kway_priority_queue.h"
 #include "kahypar/definitions.h"
@@ -71,8 +72,14 @@ class FMRefinerBase {
                                                                          std::numeric_limits<Gain>
                                                                          > >;
 #else
+  // Uses bucket queues if the gain bound passed to initialize() is small enough.
   using KWayRefinementPQ = ds::KWayPriorityQueue<HypernodeID, Gain,
-                                                 std::numeric_limits<Gain> >;
+                                                 std::numeric_limits<Gain>,
+                                                 false,
+                                                 ds::AdaptiveGainQueue<HypernodeID,
+                                                                       Gain,
+                                                                       std::numeric_limits<Gain>
+                                                                       > >;
 #endif
 
 
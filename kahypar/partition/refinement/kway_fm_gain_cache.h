@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -29,12 +30,19 @@
 #include "kahypar/partition/refinement/gain_cache_element.h"
 
 namespace kahypar {
+// The cache elements of all hypernodes are allocated from a memory arena that consists
+// of a few large chunks. Elements are only allocated for hypernodes that are touched
+// during refinement and stay allocated until the cache is destroyed, i.e., clear()
+// only resets the elements of touched hypernodes and does not free any memory.
 template <typename Gain = Mandatory>
 class KwayGainCache {
  private:
   static const bool debug = false;
   static const HypernodeID hn_to_debug = 2;
 
+  // Size of a chunk of the arena in bytes
+  static constexpr size_t kChunkSize = 1 << 20;
+
   using Byte = char;
   using KFMCacheElement = CacheElement<Gain>;
 
@@ -47,14 +55,13 @@ class KwayGainCache {
     _cache_element_size(sizeof(KFMCacheElement) +
                         _k * sizeof(typename KFMCacheElement::Element) +
                         _k * sizeof(PartitionID)),
+    _elements_per_chunk(std::max(kChunkSize / _cache_element_size, static_cast<size_t>(1))),
     _cache(std::make_unique<KFMCacheElement*[]>(num_hns)),
+    _chunks(),
+    _touched_hns(),
     _deltas() { }
 
-  ~KwayGainCache() {
-    for (size_t i = 0; i < _num_hns; ++i) {
-      delete[] (reinterpret_cast<Byte*>(_cache[i]));
-    }
-  }
+  ~KwayGainCache() = default;
 
   KwayGainCache(const KwayGainCache&) = delete;
   KwayGainCache& operator= (const KwayGainCache&) = delete;
@@ -100,7 +107,7 @@ class KwayGainCache {
                                                                          const Gain gain) {
     ASSERT(part < _k, V(part));
     if (unlikely(_cache[hn] == nullptr)) {
-      _cache[hn] = new(new Byte[_cache_element_size])KFMCacheElement(_k);
+      allocate(hn);
     }
     ASSERT(!entryExists(hn, part), V(hn) << V(part));
     cacheElement(hn)->add(part, gain);
@@ -146,7 +153,7 @@ class KwayGainCache {
     ASSERT(part < _k, V(part));
     DBGC(hn == hn_to_debug) << "initializeEntry(" << hn << "," << part << "," << value << ")";
     if (unlikely(_cache[hn] == nullptr)) {
-      _cache[hn] = new(new Byte[_cache_element_size])KFMCacheElement(_k);
+      allocate(hn);
     }
     cacheElement(hn)->add(part, value);
   }
@@ -207,15 +214,23 @@ class KwayGainCache {
   }
 
   void clear() {
-    for (HypernodeID hn = 0; hn < _num_hns; ++hn) {
-      if (_cache[hn] != nullptr) {  /// workaround
-        delete[] (reinterpret_cast<Byte*>(_cache[hn]));
-        _cache[hn] = new(new Byte[_cache_element_size])KFMCacheElement(_k);
-      }
+    for (const HypernodeID& hn : _touched_hns) {
+      new(_cache[hn])KFMCacheElement(_k);
     }
   }
 
  private:
+  void allocate(const HypernodeID hn) {
+    const size_t element = _touched_hns.size();
+    if (element / _elements_per_chunk == _chunks.size()) {
+      _chunks.emplace_back(std::make_unique<Byte[]>(_elements_per_chunk * _cache_element_size));
+    }
+    Byte* memory = _chunks[element / _elements_per_chunk].get() +
+                   (element % _elements_per_chunk) * _cache_element_size;
+    _cache[hn] = new(memory)KFMCacheElement(_k);
+    _touched_hns.push_back(hn);
+  }
+
   const KFMCacheElement* cacheElement(const HypernodeID hn) const {
     return _cache[hn];
   }
@@ -228,7 +243,11 @@ class KwayGainCache {
   PartitionID _k;
   HypernodeID _num_hns;
   const size_t _cache_element_size;
+  const size_t _elements_per_chunk;
   std::unique_ptr<KFMCacheElement*[]> _cache;
+  std::vector<std::unique_ptr<Byte[]> > _chunks;
+  // Hypernodes whose cache element is allocated (in allocation order)
+  std::vector<HypernodeID> _touched_hns;
   std::vector<RollbackElement> _deltas;
 };
 
@@ -101,12 +101,7 @@ class KWayKMinusOneRefiner final : public IRefiner,
  private:
   void initializeImpl(const HyperedgeWeight max_gain) override final {
     if (!_is_initialized) {
-#ifdef USE_BUCKET_QUEUE
       _pq.initialize(_hg.initialNumNodes(), max_gain);
-#else
-      unused(max_gain);
-      _pq.initialize(_hg.initialNumNodes());
-#endif
       _is_initialized = true;
     }
     _gain_cache.clear();
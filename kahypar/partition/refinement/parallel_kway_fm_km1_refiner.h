@@ -0,0 +1,409 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/fast_reset_flag_array.h"
+#include "kahypar/datastructure/sparse_map.h"
+#include "kahypar/definitions.h"
+#include "kahypar/meta/mandatory.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/fm_refiner_base.h"
+#include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/thread_pool.h"
+
+namespace kahypar {
+// Multi-threaded k-way FM refiner for the (connectivity - 1) metric.
+//
+// The refinement nodes are distributed round-robin into disjoint seed sets. Each
+// thread runs a localized FM search starting from its seed set. The search uses a
+// thread-local priority queue and applies its moves only to a thread-local overlay
+// of the partition (pin counts, part IDs and part weights), so the hypergraph
+// is not modified while the searches run. Afterwards, the best prefix of each
+// search is committed to the hypergraph in a fixed order. A move is skipped if
+// its hypernode was already moved by another search or if it would violate the
+// balance constraint. Its gain is recomputed on the actual partition. Finally,
+// all committed moves are rolled back to the best prefix of the combined move
+// sequence. The result depends on the number of threads, but not on the
+// scheduling of the searches.
+template <class StoppingPolicy = Mandatory,
+          class FMImprovementPolicy = CutDecreasedOrInfeasibleImbalanceDecreased>
+class ParallelKWayKMinusOneRefiner final : public IRefiner {
+ private:
+  static constexpr bool debug = false;
+
+  struct BestMove {
+    Gain gain;
+    PartitionID to_part;
+  };
+
+  class LocalizedSearch {
+ public:
+    LocalizedSearch(const Hypergraph& hypergraph, const Context& context) :
+      _hg(hypergraph),
+      _context(context),
+      _pq(hypergraph.initialNumNodes()),
+      _target_part(hypergraph.initialNumNodes(), Hypergraph::kInvalidPartition),
+      _touched(hypergraph.initialNumNodes()),
+      _moved_to(),
+      _pin_count_delta(),
+      _part_weight_delta(context.partition.k, 0),
+      _target_parts(),
+      _adjacent_weight(context.partition.k),
+      _moves(),
+      _stopping_policy() { }
+
+    LocalizedSearch(const LocalizedSearch&) = delete;
+    LocalizedSearch& operator= (const LocalizedSearch&) = delete;
+
+    LocalizedSearch(LocalizedSearch&&) = delete;
+    LocalizedSearch& operator= (LocalizedSearch&&) = delete;
+
+    ~LocalizedSearch() = default;
+
+    // Performs a localized FM search and keeps the best prefix of its moves.
+    void run(const std::vector<HypernodeID>& seeds, const HyperedgeWeight initial_km1) {
+      reset();
+      for (const HypernodeID& seed : seeds) {
+        touch(seed);
+      }
+
+      Gain current_gain = 0;
+      Gain best_gain = 0;
+      size_t best_prefix = 0;
+      int touched_hns_since_last_improvement = 0;
+      const double beta = log(_hg.currentNumNodes());
+      _stopping_policy.resetStatistics();
+      while (!_pq.empty() &&
+             !_stopping_policy.searchShouldStop(touched_hns_since_last_improvement, _context, beta,
+                                                initial_km1 - best_gain,
+                                                initial_km1 - current_gain)) {
+        const HypernodeID hn = _pq.top();
+        const Gain gain = _pq.topKey();
+        _pq.pop();
+
+        // Part weights might have changed since the gain was computed.
+        const BestMove best_move = computeBestMove(hn);
+        if (best_move.to_part == Hypergraph::kInvalidPartition) {
+          continue;
+        }
+        if (best_move.gain != gain || best_move.to_part != _target_part[hn]) {
+          _target_part[hn] = best_move.to_part;
+          _pq.push(hn, best_move.gain);
+          continue;
+        }
+
+        const PartitionID from_part = partID(hn);
+        moveHypernode(hn, from_part, best_move.to_part);
+        _moves.emplace_back(hn, from_part, best_move.to_part);
+        current_gain += best_move.gain;
+        _stopping_policy.updateStatistics(best_move.gain);
+        ++touched_hns_since_last_improvement;
+
+        if (current_gain > best_gain) {
+          best_gain = current_gain;
+          best_prefix = _moves.size();
+          touched_hns_since_last_improvement = 0;
+          _stopping_policy.resetStatistics();
+        }
+        updateNeighbours(hn);
+      }
+      DBG << "Localized search performed" << _moves.size() << "moves, best prefix:"
+          << best_prefix << "with gain" << best_gain;
+      while (_moves.size() > best_prefix) {
+        _moves.pop_back();
+      }
+    }
+
+    const std::vector<Move>& moves() const {
+      return _moves;
+    }
+
+ private:
+    void reset() {
+      _pq.clear();
+      _touched.reset();
+      _moved_to.clear();
+      _pin_count_delta.clear();
+      std::fill(_part_weight_delta.begin(), _part_weight_delta.end(), 0);
+      _target_parts.clear();
+      _moves.clear();
+    }
+
+    PartitionID partID(const HypernodeID hn) const {
+      const auto it = _moved_to.find(hn);
+      return it == _moved_to.end() ? _hg.partID(hn) : it->second;
+    }
+
+    HypernodeID pinCountInPart(const HyperedgeID he, const PartitionID part) const {
+      const auto it = _pin_count_delta.find(static_cast<size_t>(he) * _context.partition.k + part);
+      return _hg.pinCountInPart(he, part) + (it == _pin_count_delta.end() ? 0 : it->second);
+    }
+
+    HypernodeWeight partWeight(const PartitionID part) const {
+      return _hg.partWeight(part) + _part_weight_delta[part];
+    }
+
+    BestMove computeBestMove(const HypernodeID hn) {
+      const PartitionID from_part = partID(hn);
+      Gain removal_gain = 0;
+      HyperedgeWeight incident_weight = 0;
+      for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+        const HyperedgeWeight he_weight = _hg.edgeWeight(he);
+        incident_weight += he_weight;
+        if (pinCountInPart(he, from_part) == 1) {
+          removal_gain += he_weight;
+        }
+        for (const PartitionID& part : _hg.connectivitySet(he)) {
+          if (part != from_part && pinCountInPart(he, part) > 0) {
+            _adjacent_weight[part] += he_weight;
+          }
+        }
+        for (const PartitionID& part : _target_parts) {
+          if (part != from_part && _hg.pinCountInPart(he, part) == 0 &&
+              pinCountInPart(he, part) > 0) {
+            _adjacent_weight[part] += he_weight;
+          }
+        }
+      }
+
+      BestMove best_move { std::numeric_limits<Gain>::min(), Hypergraph::kInvalidPartition };
+      const HypernodeWeight weight = _hg.nodeWeight(hn);
+      for (const auto& adjacent_part : _adjacent_weight) {
+        const PartitionID part = adjacent_part.key;
+        const Gain gain = removal_gain - incident_weight + adjacent_part.value;
+        if (partWeight(part) + weight <= _context.partition.max_part_weights[part] &&
+            gain > best_move.gain) {
+          best_move = { gain, part };
+        }
+      }
+      _adjacent_weight.clear();
+      return best_move;
+    }
+
+    void touch(const HypernodeID hn) {
+      if (_touched[hn] || _hg.isFixedVertex(hn)) {
+        return;
+      }
+      _touched.set(hn, true);
+      const BestMove best_move = computeBestMove(hn);
+      if (best_move.to_part != Hypergraph::kInvalidPartition) {
+        _target_part[hn] = best_move.to_part;
+        _pq.push(hn, best_move.gain);
+      }
+    }
+
+    void moveHypernode(const HypernodeID hn, const PartitionID from_part,
+                       const PartitionID to_part) {
+      _moved_to[hn] = to_part;
+      for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+        --_pin_count_delta[static_cast<size_t>(he) * _context.partition.k + from_part];
+        ++_pin_count_delta[static_cast<size_t>(he) * _context.partition.k + to_part];
+      }
+      _part_weight_delta[from_part] -= _hg.nodeWeight(hn);
+      _part_weight_delta[to_part] += _hg.nodeWeight(hn);
+      if (std::find(_target_parts.begin(), _target_parts.end(), to_part) == _target_parts.end()) {
+        _target_parts.push_back(to_part);
+      }
+    }
+
+    void updateNeighbours(const HypernodeID hn) {
+      for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+        if (_hg.edgeSize(he) > _context.partition.hyperedge_size_threshold) {
+          continue;
+        }
+        for (const HypernodeID& pin : _hg.pins(he)) {
+          if (!_touched[pin]) {
+            touch(pin);
+          } else if (_pq.contains(pin)) {
+            const BestMove best_move = computeBestMove(pin);
+            if (best_move.to_part == Hypergraph::kInvalidPartition) {
+              _pq.remove(pin);
+            } else {
+              _target_part[pin] = best_move.to_part;
+              _pq.updateKey(pin, best_move.gain);
+            }
+          }
+        }
+      }
+    }
+
+    const Hypergraph& _hg;
+    const Context& _context;
+    ds::BinaryMaxHeap<HypernodeID, Gain> _pq;
+    std::vector<PartitionID> _target_part;
+    ds::FastResetFlagArray<> _touched;
+    std::unordered_map<HypernodeID, PartitionID> _moved_to;
+    std::unordered_map<size_t, int> _pin_count_delta;
+    std::vector<HypernodeWeight> _part_weight_delta;
+    std::vector<PartitionID> _target_parts;
+    ds::SparseMap<PartitionID, HyperedgeWeight> _adjacent_weight;
+    std::vector<Move> _moves;
+    StoppingPolicy _stopping_policy;
+  };
+
+ public:
+  ParallelKWayKMinusOneRefiner(Hypergraph& hypergraph, const Context& context) :
+    _hg(hypergraph),
+    _context(context),
+    _num_threads(std::max(context.partition.num_threads, static_cast<size_t>(1))),
+    _pool(),
+    _searches(),
+    _seeds(_num_threads),
+    _moved(hypergraph.initialNumNodes()),
+    _performed_moves() {
+    if (_num_threads > 1) {
+      _pool = std::make_unique<ThreadPool>(_num_threads);
+    }
+    for (size_t i = 0; i < _num_threads; ++i) {
+      _searches.emplace_back(std::make_unique<LocalizedSearch>(_hg, _context));
+    }
+  }
+
+  ~ParallelKWayKMinusOneRefiner() override = default;
+
+  ParallelKWayKMinusOneRefiner(const ParallelKWayKMinusOneRefiner&) = delete;
+  ParallelKWayKMinusOneRefiner& operator= (const ParallelKWayKMinusOneRefiner&) = delete;
+
+  ParallelKWayKMinusOneRefiner(ParallelKWayKMinusOneRefiner&&) = delete;
+  ParallelKWayKMinusOneRefiner& operator= (ParallelKWayKMinusOneRefiner&&) = delete;
+
+ private:
+  bool refineImpl(std::vector<HypernodeID>& refinement_nodes,
+                  const std::array<HypernodeWeight, 2>&,
+                  const UncontractionGainChanges&,
+                  Metrics& best_metrics) override final {
+    ASSERT(best_metrics.km1 == metrics::km1(_hg),
+           V(best_metrics.km1) << V(metrics::km1(_hg)));
+    const HyperedgeWeight initial_km1 = best_metrics.km1;
+    const double initial_imbalance = best_metrics.imbalance;
+
+    Randomize::instance().shuffleVector(refinement_nodes, refinement_nodes.size());
+    const size_t num_searches = std::min(_num_threads, refinement_nodes.size());
+    for (std::vector<HypernodeID>& seeds : _seeds) {
+      seeds.clear();
+    }
+    for (size_t i = 0; i < refinement_nodes.size(); ++i) {
+      addSeed(refinement_nodes[i], _seeds[i % num_searches]);
+    }
+
+    if (_pool == nullptr || num_searches == 1) {
+      _searches[0]->run(_seeds[0], initial_km1);
+    } else {
+      for (size_t i = 0; i < num_searches; ++i) {
+        _pool->enqueue([this, i, initial_km1]() {
+            _searches[i]->run(_seeds[i], initial_km1);
+          });
+      }
+      _pool->waitForAll();
+    }
+
+    _moved.reset();
+    _performed_moves.clear();
+    HyperedgeWeight current_km1 = initial_km1;
+    size_t best_prefix = 0;
+    for (size_t i = 0; i < num_searches; ++i) {
+      for (const Move& move : _searches[i]->moves()) {
+        if (_moved[move.hn] || _hg.partID(move.hn) != move.from ||
+            _hg.partWeight(move.to) + _hg.nodeWeight(move.hn) >
+            _context.partition.max_part_weights[move.to]) {
+          continue;
+        }
+        current_km1 -= gain(move.hn, move.from, move.to);
+        _hg.changeNodePart(move.hn, move.from, move.to);
+        _moved.set(move.hn, true);
+        _performed_moves.emplace_back(RollbackInfo { move.hn, move.from, move.to });
+        ASSERT(current_km1 == metrics::km1(_hg), V(current_km1) << V(metrics::km1(_hg)));
+
+        const double current_imbalance = metrics::imbalance(_hg, _context);
+        const bool improved_km1_within_balance = (current_imbalance <= _context.partition.epsilon) &&
+                                                 (current_km1 < best_metrics.km1);
+        const bool improved_balance_less_equal_km1 = (current_imbalance < best_metrics.imbalance) &&
+                                                     (current_km1 <= best_metrics.km1);
+        if (improved_km1_within_balance || improved_balance_less_equal_km1) {
+          best_metrics.km1 = current_km1;
+          best_metrics.imbalance = current_imbalance;
+          best_prefix = _performed_moves.size();
+        }
+      }
+    }
+
+    DBG << "Committed" << _performed_moves.size() << "moves, rolling back to" << best_prefix;
+    for (size_t i = _performed_moves.size(); i > best_prefix; --i) {
+      const RollbackInfo& move = _performed_moves[i - 1];
+      _hg.changeNodePart(move.hn, move.to_part, move.from_part);
+    }
+
+    ASSERT(best_metrics.km1 == metrics::km1(_hg), V(best_metrics.km1) << V(metrics::km1(_hg)));
+    ASSERT(best_metrics.km1 <= initial_km1, V(initial_km1) << V(best_metrics.km1));
+    return FMImprovementPolicy::improvementFound(best_metrics.km1, initial_km1,
+                                                 best_metrics.imbalance, initial_imbalance,
+                                                 _context.partition.epsilon);
+  }
+
+  // Fixed vertices are never moved. Instead, their free neighbors are used as seeds.
+  void addSeed(const HypernodeID hn, std::vector<HypernodeID>& seeds) const {
+    if (!_hg.isFixedVertex(hn)) {
+      seeds.push_back(hn);
+      return;
+    }
+    for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+      for (const HypernodeID& pin : _hg.pins(he)) {
+        if (!_hg.isFixedVertex(pin)) {
+          seeds.push_back(pin);
+        }
+      }
+    }
+  }
+
+  Gain gain(const HypernodeID hn, const PartitionID from_part, const PartitionID to_part) const {
+    Gain gain = 0;
+    for (const HyperedgeID& he : _hg.incidentEdges(hn)) {
+      if (_hg.pinCountInPart(he, from_part) == 1) {
+        gain += _hg.edgeWeight(he);
+      }
+      if (_hg.pinCountInPart(he, to_part) == 0) {
+        gain -= _hg.edgeWeight(he);
+      }
+    }
+    return gain;
+  }
+
+  Hypergraph& _hg;
+  const Context& _context;
+  const size_t _num_threads;
+  std::unique_ptr<ThreadPool> _pool;
+  std::vector<std::unique_ptr<LocalizedSearch> > _searches;
+  std::vector<std::vector<HypernodeID> > _seeds;
+  ds::FastResetFlagArray<> _moved;
+  std::vector<RollbackInfo> _performed_moves;
+};
+}  // namespace kahypar
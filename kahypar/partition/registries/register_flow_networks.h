@@ -41,6 +41,11 @@ REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::goldberg_tarjan, GoldbergTarj
 REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::goldberg_tarjan, GoldbergTarjan, WongNetwork);
 REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::goldberg_tarjan, GoldbergTarjan, HybridNetwork);
 
+REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::parallel_push_relabel, ParallelPushRelabel, LawlerNetwork);
+REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::parallel_push_relabel, ParallelPushRelabel, HeuerNetwork);
+REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::parallel_push_relabel, ParallelPushRelabel, WongNetwork);
+REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::parallel_push_relabel, ParallelPushRelabel, HybridNetwork);
+
 REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::boykov_kolmogorov, BoykovKolmogorov, LawlerNetwork);
 REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::boykov_kolmogorov, BoykovKolmogorov, HeuerNetwork);
 REGISTER_FLOW_ALGORITHM_FOR_NETWORK(FlowAlgorithm::boykov_kolmogorov, BoykovKolmogorov, WongNetwork);
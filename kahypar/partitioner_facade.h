@@ -22,6 +22,7 @@
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -37,6 +38,8 @@
 #include "kahypar/partition/metrics.h"
 #include "kahypar/utils/math.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/thread_pool.h"
+#include "kahypar/utils/timer.h"
 
 namespace kahypar {
 class PartitionerFacade {
@@ -166,10 +169,132 @@ class PartitionerFacade {
     return iteration;
   }
 
+  // Best solution found by one worker of the parallel time-limited repeated partitioning.
+  struct RepeatedPartitioningResult {
+    RepeatedPartitioningResult() :
+      quality(std::numeric_limits<HyperedgeWeight>::max()),
+      imbalance(std::numeric_limits<double>::max()),
+      balanced(false),
+      worker(std::numeric_limits<size_t>::max()),
+      run(std::numeric_limits<size_t>::max()),
+      partition(),
+      timings() { }
+
+    HyperedgeWeight quality;
+    double imbalance;
+    bool balanced;
+    size_t worker;
+    size_t run;
+    std::vector<PartitionID> partition;
+    Timer::Timings timings;
+  };
+
+  // Balanced solutions are preferred over imbalanced ones. Ties are broken by quality,
+  // imbalance and finally by (worker, run) to make the reduction independent of the order
+  // in which the workers finish.
+  static bool isBetter(const RepeatedPartitioningResult& lhs,
+                       const RepeatedPartitioningResult& rhs) {
+    if (lhs.balanced != rhs.balanced) {
+      return lhs.balanced;
+    }
+    if (lhs.quality != rhs.quality) {
+      return lhs.quality < rhs.quality;
+    }
+    if (lhs.imbalance != rhs.imbalance) {
+      return lhs.imbalance < rhs.imbalance;
+    }
+    return std::make_pair(lhs.worker, lhs.run) < std::make_pair(rhs.worker, rhs.run);
+  }
+
+  // Each worker repeatedly partitions its own copy of the hypergraph until the time limit is
+  // reached. The random seed of worker i is derived from (seed, i), i.e., the sequence of
+  // solutions computed by a worker only depends on the seed and the number of threads.
+  size_t performParallelTimeLimitedRepeatedPartitioning(Hypergraph& hypergraph,
+                                                        Context& context) {
+    const size_t num_workers = context.partition.num_threads;
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    const auto elapsed_time = [&start]() {
+                                return std::chrono::duration<double>(
+                                  std::chrono::high_resolution_clock::now() - start);
+                              };
+
+    // The per-run output is printed using the original context.
+    context.setupPartWeights(hypergraph.totalWeight());
+
+    std::vector<RepeatedPartitioningResult> best_results(num_workers);
+    std::mutex output_mutex;
+    size_t iteration = 0;
+
+    ThreadPool pool(num_workers);
+    for (size_t worker = 0; worker < num_workers; ++worker) {
+      pool.enqueue([&, worker]() {
+          Randomize::instance().setSeed(Randomize::deriveSeed(context.partition.seed, worker));
+          auto copy = ds::reindex(hypergraph);
+          Hypergraph& worker_hypergraph = *copy.first;
+          const std::vector<HypernodeID>& to_original = copy.second;
+
+          Context worker_context(context);
+          worker_context.stats.detach();
+          worker_context.partition.num_threads = 1;
+          worker_context.partition.quiet_mode = true;
+
+          RepeatedPartitioningResult& best = best_results[worker];
+          best.partition.resize(hypergraph.initialNumNodes(), 0);
+
+          Partitioner partitioner;
+          for (size_t run = 0; elapsed_time().count() < context.partition.time_limit; ++run) {
+            Timer::instance().clear();
+            partitioner.partition(worker_hypergraph, worker_context);
+
+            RepeatedPartitioningResult current;
+            current.quality = metrics::correctMetric(worker_hypergraph, worker_context);
+            current.imbalance = metrics::imbalance(worker_hypergraph, worker_context);
+            current.balanced = current.imbalance <= worker_context.partition.epsilon;
+            current.worker = worker;
+            current.run = run;
+
+            {
+              std::lock_guard<std::mutex> lock(output_mutex);
+              io::printPartitioningResults(worker_hypergraph, context, elapsed_time());
+              io::serializer::serialize(worker_context, worker_hypergraph, elapsed_time(),
+                                        iteration);
+              ++iteration;
+            }
+
+            if (isBetter(current, best)) {
+              best.quality = current.quality;
+              best.imbalance = current.imbalance;
+              best.balanced = current.balanced;
+              best.run = run;
+              best.worker = worker;
+              for (const HypernodeID& hn : worker_hypergraph.nodes()) {
+                best.partition[to_original[hn]] = worker_hypergraph.partID(hn);
+              }
+              best.timings = Timer::instance().releaseTimings(0);
+            }
+            worker_hypergraph.reset();
+          }
+        });
+    }
+    pool.waitForAll();
+
+    const RepeatedPartitioningResult* best = &best_results[0];
+    for (const RepeatedPartitioningResult& result : best_results) {
+      if (isBetter(result, *best)) {
+        best = &result;
+      }
+    }
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, best->partition[hn]);
+    }
+    Timer::instance().addTimings(best->timings);
+    return iteration;
+  }
+
   void performEvolutionaryPartitioning(Hypergraph& hypergraph, Context& context) {
     EvoPartitioner evo_partitioner(context);
     evo_partitioner.partition(hypergraph, context);
-    const std::vector<PartitionID>& best_partition = evo_partitioner.bestPartition();
+    const std::vector<PartitionID> best_partition = evo_partitioner.bestPartition();
 
     hypergraph.reset();
     for (const auto& hn : hypergraph.nodes()) {
@@ -181,7 +306,10 @@ class PartitionerFacade {
                                                                        Context& context) {
     size_t iteration = 0;
     const HighResClockTimepoint complete_start = std::chrono::high_resolution_clock::now();
-    if (context.partition.time_limit != 0 && !context.partition_evolutionary) {
+    if (context.partition.time_limit != 0 && !context.partition_evolutionary &&
+        context.partition.num_threads > 1) {
+      iteration = performParallelTimeLimitedRepeatedPartitioning(hypergraph, context);
+    } else if (context.partition.time_limit != 0 && !context.partition_evolutionary) {
       iteration = performTimeLimitedRepeatedPartitioning(hypergraph, context);
     } else if (context.partition_evolutionary && context.partition.time_limit != 0) {
       performEvolutionaryPartitioning(hypergraph, context);
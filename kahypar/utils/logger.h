@@ -66,12 +66,13 @@ class Logger {
     return *this;
   }
 
+  // The message is written with a single output operation such that messages
+  // of concurrently logging threads do not get interleaved.
   ~Logger() {
+    _oss << (_newline ? '\n' : ' ');
     std::cout << _oss.str();
     if (_newline) {
-      std::cout << std::endl;
-    } else {
-      std::cout << ' ';
+      std::cout.flush();
     }
   }
 
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <ctime>
 #include <limits>
 #include <random>
@@ -34,8 +35,10 @@ class Randomize {
   Randomize& operator= (const Randomize&) = delete;
   Randomize& operator= (Randomize&&) = delete;
 
+  // Each thread has its own random number generator. Parallel code paths
+  // therefore have to seed the generator of each worker thread explicitly.
   static Randomize & instance() {
-    static Randomize instance;
+    static thread_local Randomize instance;
     return instance;
   }
 
@@ -47,9 +50,32 @@ class Randomize {
     return _int_dist(_gen);
   }
 
+  // Reseeding also resets the internal state of all distributions, i.e.,
+  // two generators seeded with the same seed produce the same sequence.
   void setSeed(int seed) {
     _seed = seed;
     _gen.seed(_seed);
+    _bool_dist.reset();
+    _int_dist.reset();
+    _float_dist.reset();
+    _norm_dist.reset();
+  }
+
+  int seed() const {
+    return _seed;
+  }
+
+  // Deterministically derives the seed of an independent sub-task (e.g. a
+  // sub-problem solved by a different thread) from the seed of its parent.
+  // The result only depends on the arguments and not on the state of any generator.
+  static int deriveSeed(const int seed, const uint32_t task) {
+    uint64_t x = (static_cast<uint64_t>(static_cast<uint32_t>(seed)) << 32) | task;
+    // splitmix64 finalizer
+    x += UINT64_C(0x9E3779B97F4A7C15);
+    x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+    x = x ^ (x >> 31);
+    return static_cast<int>(x & static_cast<uint64_t>(std::numeric_limits<int>::max()));
   }
 
   template <typename T>
@@ -86,7 +86,7 @@ class Stats {
   }
 
   void add(const StatTag& tag, const std::string& key, const double& value) {
-    _logs[static_cast<size_t>(tag)][key] = value;
+    _logs[static_cast<size_t>(tag)][key] += value;
   }
 
   Stats & topLevel() {
@@ -96,6 +96,18 @@ class Stats {
     return *this;
   }
 
+  // Stats of parallel tasks are detached from their parent and gathered
+  // independently. They are merged into the top-level stats afterwards.
+  void detach() {
+    _parent = nullptr;
+  }
+
+  void merge(Stats& other) {
+    ASSERT(other._parent == nullptr);
+    parentOutputStream() << other.serialize().str();
+    other._oss.str("");
+  }
+
   std::ostringstream & serialize() {
     serializeToParent();
     return _oss;
@@ -158,6 +170,10 @@ class Stats {
 
   Stats & topLevel() { return *this; }
 
+  void detach() { }
+
+  void merge(Stats&) { }
+
   std::ostringstream & serialize() {
     return _oss;
   }
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "kahypar/macros.h"
+
+namespace kahypar {
+// Simple work-stealing thread pool. Each worker owns a task deque. Tasks enqueued
+// by a worker (e.g. the two sub-problems of a bisection) are pushed to its own
+// deque and processed in LIFO order, while idle workers steal the oldest tasks
+// of other workers. Tasks enqueued from outside the pool are distributed round-robin.
+class ThreadPool {
+ public:
+  using Task = std::function<void ()>;
+
+  explicit ThreadPool(const size_t num_threads) :
+    _queues(),
+    _workers(),
+    _mutex(),
+    _work_available(),
+    _all_done(),
+    _num_queued(0),
+    _num_unfinished(0),
+    _next_queue(0),
+    _stop(false) {
+    const size_t num_workers = std::max(num_threads, static_cast<size_t>(1));
+    for (size_t i = 0; i < num_workers; ++i) {
+      _queues.emplace_back(std::make_unique<WorkQueue>());
+    }
+    for (size_t i = 0; i < num_workers; ++i) {
+      _workers.emplace_back([this, i]() {
+          work(i);
+        });
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator= (const ThreadPool&) = delete;
+
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator= (ThreadPool&&) = delete;
+
+  ~ThreadPool() {
+    waitForAll();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _work_available.notify_all();
+    for (std::thread& worker : _workers) {
+      worker.join();
+    }
+  }
+
+  size_t numThreads() const {
+    return _workers.size();
+  }
+
+  // Tasks may enqueue further tasks.
+  void enqueue(Task task) {
+    const size_t queue = (currentPool() == this) ? currentWorker() : nextQueue();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      ++_num_unfinished;
+      ++_num_queued;
+      std::lock_guard<std::mutex> queue_lock(_queues[queue]->mutex);
+      _queues[queue]->tasks.emplace_back(std::move(task));
+    }
+    _work_available.notify_one();
+  }
+
+  // Blocks until all enqueued tasks (including tasks spawned by them) are finished.
+  // Must not be called from within a task.
+  void waitForAll() {
+    ASSERT(currentPool() != this, "waitForAll() called from worker thread");
+    std::unique_lock<std::mutex> lock(_mutex);
+    _all_done.wait(lock, [this]() {
+        return _num_unfinished == 0;
+      });
+  }
+
+ private:
+  struct WorkQueue {
+    WorkQueue() :
+      mutex(),
+      tasks() { }
+
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  static ThreadPool* & currentPool() {
+    static thread_local ThreadPool* pool = nullptr;
+    return pool;
+  }
+
+  static size_t & currentWorker() {
+    static thread_local size_t worker = 0;
+    return worker;
+  }
+
+  size_t nextQueue() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const size_t queue = _next_queue;
+    _next_queue = (_next_queue + 1) % _queues.size();
+    return queue;
+  }
+
+  bool popOwn(const size_t worker, Task& task) {
+    WorkQueue& queue = *_queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+  }
+
+  bool steal(const size_t worker, Task& task) {
+    for (size_t i = 1; i < _queues.size(); ++i) {
+      WorkQueue& queue = *_queues[(worker + i) % _queues.size()];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void work(const size_t worker) {
+    currentPool() = this;
+    currentWorker() = worker;
+    while (true) {
+      Task task;
+      if (popOwn(worker, task) || steal(worker, task)) {
+        {
+          std::lock_guard<std::mutex> lock(_mutex);
+          --_num_queued;
+        }
+        task();
+        bool all_done = false;
+        {
+          std::lock_guard<std::mutex> lock(_mutex);
+          all_done = (--_num_unfinished == 0);
+        }
+        if (all_done) {
+          _all_done.notify_all();
+        }
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(_mutex);
+      _work_available.wait(lock, [this]() {
+          return _stop || _num_queued > 0;
+        });
+      if (_stop && _num_queued == 0) {
+        return;
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<WorkQueue> > _queues;
+  std::vector<std::thread> _workers;
+  std::mutex _mutex;
+  std::condition_variable _work_available;
+  std::condition_variable _all_done;
+  size_t _num_queued;
+  size_t _num_unfinished;
+  size_t _next_queue;
+  bool _stop;
+};
+}  // namespace kahypar
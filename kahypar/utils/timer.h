@@ -104,12 +104,31 @@ class Timer {
   };
 
  public:
+  using Timings = std::vector<Timing>;
+
   void add(const Context& context, const Timepoint& timepoint, const double& time) {
     _timings.emplace_back(context, timepoint, time);
   }
 
+  // Timings of parallel tasks are recorded by the timer of the executing worker
+  // thread and are handed over to the timer of the calling thread afterwards.
+  size_t numTimings() const {
+    return _timings.size();
+  }
+
+  Timings releaseTimings(const size_t first) {
+    ASSERT(first <= _timings.size());
+    Timings timings(_timings.begin() + first, _timings.end());
+    _timings.erase(_timings.begin() + first, _timings.end());
+    return timings;
+  }
+
+  void addTimings(const Timings& timings) {
+    _timings.insert(_timings.end(), timings.begin(), timings.end());
+  }
+
   static Timer & instance() {
-    static Timer instance;
+    static thread_local Timer instance;
     return instance;
   }
 
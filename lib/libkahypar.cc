@@ -25,6 +25,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partitioner_facade.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/timer.h"
 
 
 kahypar_context_t* kahypar_context_new() {
@@ -57,7 +58,12 @@ void kahypar_partition(const kahypar_hypernode_id_t num_vertices,
                        kahypar_hyperedge_weight_t* objective,
                        kahypar_context_t* kahypar_context,
                        kahypar_partition_id_t* partition) {
-  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  // Each call works on its own copy of the context and all remaining global state
+  // (random number generator, timer) is thread-local. Therefore different threads
+  // can partition different hypergraphs concurrently using the same context.
+  kahypar::Context context(*reinterpret_cast<const kahypar::Context*>(kahypar_context));
+  context.stats.detach();
+  kahypar::Timer::instance().clear();
 
   context.partition.k = num_blocks;
   context.partition.epsilon = epsilon;
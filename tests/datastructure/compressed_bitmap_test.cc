@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/compressed_bitmap.h"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+using Bitmap = CompressedBitmap<uint32_t>;
+
+static std::vector<uint32_t> everyNth(const uint32_t n, const uint32_t offset,
+                                      const uint32_t universe_size) {
+  std::vector<uint32_t> elements;
+  for (uint32_t id = offset; id < universe_size; id += n) {
+    elements.push_back(id);
+  }
+  return elements;
+}
+
+TEST(ACompressedBitmap, StoresSparseSetsAsSortedArray) {
+  const Bitmap bitmap({ 3, 500, 999 }, 1000);
+  ASSERT_FALSE(bitmap.isBitmap());
+  ASSERT_EQ(bitmap.size(), 3);
+  ASSERT_TRUE(bitmap.contains(500));
+  ASSERT_FALSE(bitmap.contains(501));
+  ASSERT_THAT(bitmap.elements(), ElementsAre(3, 500, 999));
+}
+
+TEST(ACompressedBitmap, StoresDenseSetsAsBitmap) {
+  const std::vector<uint32_t> elements = everyNth(3, 1, 1000);
+  const Bitmap bitmap(elements, 1000);
+  ASSERT_TRUE(bitmap.isBitmap());
+  ASSERT_EQ(bitmap.size(), elements.size());
+  ASSERT_TRUE(bitmap.contains(997));
+  ASSERT_FALSE(bitmap.contains(998));
+  ASSERT_EQ(bitmap.elements(), elements);
+  ASSERT_LT(bitmap.sizeInBytes(), elements.size() * sizeof(uint32_t));
+}
+
+TEST(ACompressedBitmap, ComputesTheSizeOfTheSymmetricDifference) {
+  const uint32_t universe_size = 1000;
+  std::vector<std::vector<uint32_t> > sets = { { }, { 0, 999 } };
+  for (const uint32_t n : { 2, 3, 5, 97, 211 }) {
+    for (const uint32_t offset : { 0, 1 }) {
+      sets.push_back(everyNth(n, offset, universe_size));
+    }
+  }
+
+  for (const auto& lhs : sets) {
+    for (const auto& rhs : sets) {
+      std::vector<uint32_t> difference;
+      std::set_symmetric_difference(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                    std::back_inserter(difference));
+      const Bitmap lhs_bitmap(lhs, universe_size);
+      const Bitmap rhs_bitmap(rhs, universe_size);
+      ASSERT_EQ(lhs_bitmap.symmetricDifferenceSize(rhs_bitmap), difference.size());
+    }
+  }
+}
+}  // namespace ds
+}  // namespace kahypar
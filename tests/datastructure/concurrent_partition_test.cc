@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/concurrent_partition.h"
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/metrics.h"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+class AConcurrentPartition : public Test {
+ public:
+  AConcurrentPartition() :
+    hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9,  /*sentinel*/ 12 },
+               HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 }, 3) {
+    hypergraph.setNodePart(0, 0);
+    hypergraph.setNodePart(1, 0);
+    hypergraph.setNodePart(2, 0);
+    hypergraph.setNodePart(3, 1);
+    hypergraph.setNodePart(4, 1);
+    hypergraph.setNodePart(5, 2);
+    hypergraph.setNodePart(6, 2);
+    hypergraph.initializeNumCutHyperedges();
+  }
+
+  Hypergraph hypergraph;
+};
+
+TEST_F(AConcurrentPartition, IsInitializedWithThePartitionOfTheHypergraph) {
+  ConcurrentPartition partition(hypergraph);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_THAT(partition.partID(hn), Eq(hypergraph.partID(hn)));
+  }
+  for (PartitionID part = 0; part < 3; ++part) {
+    ASSERT_THAT(partition.partWeight(part), Eq(hypergraph.partWeight(part)));
+    ASSERT_THAT(partition.partSize(part), Eq(hypergraph.partSize(part)));
+  }
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    ASSERT_THAT(partition.connectivity(he), Eq(hypergraph.connectivity(he)));
+    for (PartitionID part = 0; part < 3; ++part) {
+      ASSERT_THAT(partition.pinCountInPart(he, part), Eq(hypergraph.pinCountInPart(he, part)));
+      ASSERT_THAT(partition.isConnected(he, part), Eq(hypergraph.pinCountInPart(he, part) > 0));
+    }
+  }
+}
+
+TEST_F(AConcurrentPartition, ReportsPinCountsAfterAMove) {
+  ConcurrentPartition partition(hypergraph);
+  std::vector<HyperedgeID> left_from_part;
+  std::vector<HyperedgeID> connected_to_part;
+  ASSERT_TRUE(partition.changeNodePart(2, 0, 2, 3,
+                                       [&](const HyperedgeID he, const HyperedgeWeight,
+                                           const HypernodeID,
+                                           const HypernodeID pin_count_in_from_part_after,
+                                           const HypernodeID pin_count_in_to_part_after) {
+        if (pin_count_in_from_part_after == 0) {
+          left_from_part.push_back(he);
+        }
+        if (pin_count_in_to_part_after == 1) {
+          connected_to_part.push_back(he);
+        }
+      }));
+  ASSERT_THAT(left_from_part, Eq(std::vector<HyperedgeID>{ 3 }));
+  ASSERT_THAT(connected_to_part, Eq(std::vector<HyperedgeID>{ 0 }));
+  ASSERT_THAT(partition.connectivity(0), Eq(2));
+  ASSERT_THAT(partition.connectivity(3), Eq(1));
+  ASSERT_THAT(partition.partWeight(2), Eq(3));
+}
+
+TEST_F(AConcurrentPartition, RejectsMovesThatViolateTheMaximumBlockWeight) {
+  ConcurrentPartition partition(hypergraph);
+  ASSERT_FALSE(partition.changeNodePart(2, 0, 2, 2,
+                                        [](const HyperedgeID, const HyperedgeWeight,
+                                           const HypernodeID, const HypernodeID,
+                                           const HypernodeID) { }));
+  ASSERT_THAT(partition.partID(2), Eq(0));
+  ASSERT_THAT(partition.partWeight(2), Eq(2));
+}
+
+TEST_F(AConcurrentPartition, RejectsMovesOfHypernodesThatAreNotInTheSourceBlock) {
+  ConcurrentPartition partition(hypergraph);
+  ASSERT_TRUE(partition.changeNodePart(2, 0, 1));
+  ASSERT_FALSE(partition.changeNodePart(2, 0, 2));
+  ASSERT_THAT(partition.partID(2), Eq(1));
+  ASSERT_THAT(partition.partWeight(2), Eq(2));
+}
+
+TEST(AConcurrentPartitionModifiedByMultipleThreads, IsConsistentWithTheSequentialPartition) {
+  const PartitionID k = 4;
+  Hypergraph hypergraph(io::createHypergraphFromFile(
+                          "../../../tests/partition/initial_partitioning/test_instances/test_instance.hgr",
+                          k));
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, hn % k);
+  }
+  hypergraph.initializeNumCutHyperedges();
+  const HyperedgeWeight initial_km1 = metrics::km1(hypergraph);
+
+  ConcurrentPartition partition(hypergraph);
+  const size_t num_threads = 4;
+  std::atomic<HyperedgeWeight> km1_delta(0);
+  std::vector<std::thread> threads;
+  for (size_t thread = 0; thread < num_threads; ++thread) {
+    threads.emplace_back([&, thread]() {
+        for (PartitionID round = 1; round < 3 * k; ++round) {
+          for (HypernodeID hn = thread; hn < hypergraph.initialNumNodes(); hn += num_threads) {
+            const PartitionID from = partition.partID(hn);
+            const PartitionID to = (from + round) % k;
+            if (from == to) {
+              continue;
+            }
+            partition.changeNodePart(hn, from, to, std::numeric_limits<HypernodeWeight>::max(),
+                                     [&](const HyperedgeID, const HyperedgeWeight edge_weight,
+                                         const HypernodeID,
+                                         const HypernodeID pin_count_in_from_part_after,
+                                         const HypernodeID pin_count_in_to_part_after) {
+                  km1_delta += (pin_count_in_to_part_after == 1 ? edge_weight : 0) -
+                               (pin_count_in_from_part_after == 0 ? edge_weight : 0);
+                });
+          }
+        }
+      });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  partition.applyTo(hypergraph);
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    ASSERT_THAT(partition.connectivity(he), Eq(hypergraph.connectivity(he)));
+    for (PartitionID part = 0; part < k; ++part) {
+      ASSERT_THAT(partition.pinCountInPart(he, part), Eq(hypergraph.pinCountInPart(he, part)));
+      ASSERT_THAT(partition.isConnected(he, part), Eq(hypergraph.pinCountInPart(he, part) > 0));
+    }
+  }
+  for (PartitionID part = 0; part < k; ++part) {
+    ASSERT_THAT(partition.partWeight(part), Eq(hypergraph.partWeight(part)));
+  }
+  ASSERT_THAT(metrics::km1(hypergraph), Eq(initial_km1 + km1_delta));
+}
+}  // namespace kahypar
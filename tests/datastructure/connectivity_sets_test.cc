@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <set>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/connectivity_sets.h"
+#include "kahypar/definitions.h"
+
+using ::testing::Eq;
+using ::testing::TestWithParam;
+using ::testing::Values;
+
+namespace kahypar {
+namespace ds {
+using TestConnectivitySets = ConnectivitySets<PartitionID, HyperedgeID>;
+
+class AConnectivitySet : public TestWithParam<PartitionID>{
+ public:
+  AConnectivitySet() :
+    k(GetParam()),
+    connectivity_sets(3, k) { }
+
+  std::set<PartitionID> blocks(const HyperedgeID he) const {
+    std::set<PartitionID> blocks;
+    for (const PartitionID& block : connectivity_sets[he]) {
+      blocks.insert(block);
+    }
+    return blocks;
+  }
+
+  const PartitionID k;
+  TestConnectivitySets connectivity_sets;
+};
+
+INSTANTIATE_TEST_CASE_P(BitsetAndDenseLayout,
+                        AConnectivitySet,
+                        Values(4, 64, 65, TestConnectivitySets::kMaxBitsetK,
+                               TestConnectivitySets::kMaxBitsetK + 1));
+
+TEST_P(AConnectivitySet, IsEmptyAfterInitialization) {
+  for (HyperedgeID he = 0; he < 3; ++he) {
+    ASSERT_THAT(connectivity_sets[he].size(), Eq(0));
+    ASSERT_TRUE(connectivity_sets[he].begin() == connectivity_sets[he].end());
+    for (PartitionID block = 0; block < k; ++block) {
+      ASSERT_FALSE(connectivity_sets[he].contains(block));
+    }
+  }
+}
+
+TEST_P(AConnectivitySet, ContainsAddedBlocks) {
+  connectivity_sets[1].add(k - 1);
+  connectivity_sets[1].add(0);
+  connectivity_sets[1].add(k / 2);
+  ASSERT_THAT(connectivity_sets[1].size(), Eq(3));
+  ASSERT_THAT(blocks(1), Eq(std::set<PartitionID>{ 0, k / 2, k - 1 }));
+  ASSERT_TRUE(connectivity_sets[1].contains(k - 1));
+  ASSERT_FALSE(connectivity_sets[0].contains(k - 1));
+  ASSERT_FALSE(connectivity_sets[2].contains(0));
+}
+
+TEST_P(AConnectivitySet, DoesNotContainRemovedBlocks) {
+  connectivity_sets[1].add(k - 1);
+  connectivity_sets[1].add(0);
+  connectivity_sets[1].remove(k - 1);
+  ASSERT_THAT(connectivity_sets[1].size(), Eq(1));
+  ASSERT_THAT(blocks(1), Eq(std::set<PartitionID>{ 0 }));
+  ASSERT_FALSE(connectivity_sets[1].contains(k - 1));
+}
+
+TEST_P(AConnectivitySet, IsEmptyAfterClear) {
+  for (PartitionID block = 0; block < k; ++block) {
+    connectivity_sets[2].add(block);
+  }
+  ASSERT_THAT(connectivity_sets[2].size(), Eq(k));
+  ASSERT_THAT(static_cast<PartitionID>(blocks(2).size()), Eq(k));
+  connectivity_sets[2].clear();
+  ASSERT_THAT(connectivity_sets[2].size(), Eq(0));
+  ASSERT_TRUE(blocks(2).empty());
+}
+}  // namespace ds
+}  // namespace kahypar
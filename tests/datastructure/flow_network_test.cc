@@ -119,6 +119,45 @@ TEST_F(BasicFlowNetworkTest, FlowNetworkStats) {
   ASSERT_EQ(24, flowNetwork.initialSize());
 }
 
+TEST_F(BasicFlowNetworkTest, StoresTheReverseEdgeOfEachEdge) {
+  setupFlowNetwork();
+  for (const NodeID& node : flowNetwork.nodes()) {
+    for (FlowEdge& e : flowNetwork.incidentEdges(node)) {
+      const FlowEdge& reverse_edge = flowNetwork.reverseEdge(e);
+      ASSERT_EQ(node, e.source);
+      ASSERT_EQ(e.source, reverse_edge.target);
+      ASSERT_EQ(e.target, reverse_edge.source);
+      ASSERT_EQ(&e, &flowNetwork.reverseEdge(reverse_edge));
+    }
+  }
+}
+
+TEST_F(BasicFlowNetworkTest, IsTheSameAfterItIsRebuilt) {
+  setupFlowNetwork();
+  std::vector<std::vector<edge> > edges;
+  for (const NodeID& node : flowNetwork.nodes()) {
+    edges.emplace_back();
+    for (const FlowEdge& e : flowNetwork.incidentEdges(node)) {
+      edges.back().push_back(EDGE(e.target, e.capacity));
+    }
+  }
+
+  flowNetwork.reset();
+  hypergraph.resetPartitioning();
+  setupFlowNetwork();
+
+  ASSERT_EQ(20, flowNetwork.numNodes());
+  ASSERT_EQ(35, flowNetwork.numEdges());
+  size_t i = 0;
+  for (const NodeID& node : flowNetwork.nodes()) {
+    std::vector<edge> rebuilt_edges;
+    for (const FlowEdge& e : flowNetwork.incidentEdges(node)) {
+      rebuilt_edges.push_back(EDGE(e.target, e.capacity));
+    }
+    ASSERT_THAT(rebuilt_edges, Eq(edges[i++]));
+  }
+}
+
 // ###################### Lawler Flow Network Test ######################
 
 using LawlerNetworkTest = FlowNetworkTest<LawlerNetwork>;
@@ -213,6 +213,38 @@ TEST_F(ABipartiteGraph, ReturnsCorrectMappingToContractedGraph) {
   }
 }
 
+TEST_F(ABipartiteGraph, ContractsClustersInParallelLikeTheSequentialContraction) {
+  Graph parallel_graph(hypergraph, context);
+  const std::vector<std::pair<NodeID, ClusterID> > clustering = {
+    { 2, 0 }, { 7, 0 }, { 1, 3 }, { 4, 3 }, { 8, 3 }, { 9, 3 }, { 5, 6 }, { 10, 6 }
+  };
+  for (const auto& node_cluster : clustering) {
+    graph->setClusterID(node_cluster.first, node_cluster.second);
+    parallel_graph.setClusterID(node_cluster.first, node_cluster.second);
+  }
+  ThreadPool pool(2);
+
+  auto sequential = graph->contractClusters();
+  auto parallel = parallel_graph.contractClusters(pool);
+
+  ASSERT_THAT(parallel.second, Eq(sequential.second));
+  ASSERT_EQ(sequential.first.numNodes(), parallel.first.numNodes());
+  ASSERT_EQ(sequential.first.totalWeight(), parallel.first.totalWeight());
+  for (const NodeID& node : sequential.first.nodes()) {
+    ASSERT_EQ(sequential.first.clusterID(node), parallel.first.clusterID(node));
+    ASSERT_EQ(sequential.first.degree(node), parallel.first.degree(node));
+    auto parallel_edge = parallel.first.incidentEdges(node).first;
+    for (const Edge& e : sequential.first.incidentEdges(node)) {
+      ASSERT_EQ(e.target_node, parallel_edge->target_node);
+      ASSERT_EQ(e.weight, parallel_edge->weight);
+      ++parallel_edge;
+    }
+  }
+  for (const NodeID& node : graph->nodes()) {
+    ASSERT_EQ(graph->clusterID(node), parallel_graph.clusterID(node));
+  }
+}
+
 TEST_F(ABipartiteGraph, ReturnCorrectContractedGraph) {
   graph->setClusterID(2, 0);
   graph->setClusterID(7, 0);
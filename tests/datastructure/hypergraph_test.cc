@@ -1141,5 +1141,47 @@ TEST(Hypergraphs, CanBeStrippedOfAllParallelHyperedges) {
   ASSERT_EQ(hypergraph.edgeWeight(2), 1);
   ASSERT_EQ(hypergraph.edgeWeight(3), 1);
 }
+
+TEST(AHypergraphPruner, OnlyProbesHyperedgesThatWereAffectedByTheContraction) {
+  Hypergraph hypergraph(5, 5, HyperedgeIndexVector { 0, 2, 4, 6, 8, /*sentinel*/ 10 },
+                        HyperedgeVector { 0, 1, 0, 2, 0, 3, 0, 4, 1, 2 });
+  Hypergraph original(5, 5, HyperedgeIndexVector { 0, 2, 4, 6, 8, /*sentinel*/ 10 },
+                      HyperedgeVector { 0, 1, 0, 2, 0, 3, 0, 4, 1, 2 });
+  HypergraphPruner hypergraph_pruner(hypergraph.initialNumNodes());
+  hypergraph_pruner.initializeFingerprintIndex(hypergraph);
+
+  CoarseningMemento memento(hypergraph.contract(1, 2));
+  hypergraph_pruner.removeSingleNodeHyperedges(hypergraph, memento);
+  ASSERT_THAT(hypergraph_pruner.removeParallelHyperedges(hypergraph, memento), Eq(1));
+
+  ASSERT_THAT(hypergraph_pruner.numProbes(), Eq(1));
+  ASSERT_THAT(hypergraph_pruner.numSavedProbes(), Eq(1));
+  ASSERT_THAT(hypergraph.currentNumEdges(), Eq(3));
+  ASSERT_THAT(hypergraph.edgeIsEnabled(0) != hypergraph.edgeIsEnabled(1), Eq(true));
+  ASSERT_THAT(hypergraph.edgeWeight(hypergraph.edgeIsEnabled(0) ? 0 : 1), Eq(2));
+
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, 0);
+  }
+  hypergraph_pruner.restoreParallelHyperedges(hypergraph, memento);
+  hypergraph_pruner.restoreSingleNodeHyperedges(hypergraph, memento);
+  hypergraph.uncontract(memento.contraction_memento);
+  ASSERT_THAT(verifyEquivalenceWithoutPartitionInfo(original, hypergraph), Eq(true));
+}
+
+TEST(AHypergraphPruner, RemovesParallelHyperedgesOfTheInputThatWereNotAffectedByTheContraction) {
+  Hypergraph hypergraph(3, 3, HyperedgeIndexVector { 0, 2, 4, /*sentinel*/ 6 },
+                        HyperedgeVector { 0, 1, 0, 1, 1, 2 });
+  HypergraphPruner hypergraph_pruner(hypergraph.initialNumNodes());
+  hypergraph_pruner.initializeFingerprintIndex(hypergraph);
+
+  CoarseningMemento memento(hypergraph.contract(1, 2));
+  hypergraph_pruner.removeSingleNodeHyperedges(hypergraph, memento);
+  ASSERT_THAT(hypergraph_pruner.removeParallelHyperedges(hypergraph, memento), Eq(1));
+
+  ASSERT_THAT(hypergraph_pruner.numProbes(), Eq(2));
+  ASSERT_THAT(hypergraph_pruner.numSavedProbes(), Eq(0));
+  ASSERT_THAT(hypergraph.currentNumEdges(), Eq(1));
+}
 }  // namespace ds
 }  // namespace kahypar
@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/packed_partition.h"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+TEST(APackedPartition, UsesTheMinimumNumberOfBitsPerBlockID) {
+  ASSERT_EQ(PackedPartition::bitsPerBlockID(1), 1);
+  ASSERT_EQ(PackedPartition::bitsPerBlockID(2), 1);
+  ASSERT_EQ(PackedPartition::bitsPerBlockID(3), 2);
+  ASSERT_EQ(PackedPartition::bitsPerBlockID(4), 2);
+  ASSERT_EQ(PackedPartition::bitsPerBlockID(5), 3);
+  ASSERT_EQ(PackedPartition::bitsPerBlockID(256), 8);
+  ASSERT_EQ(PackedPartition::bitsPerBlockID(257), 9);
+}
+
+TEST(APackedPartition, StoresTheBlockIDsOfAllHypernodes) {
+  for (const PartitionID k : { 2, 3, 7, 8, 64, 100, 1024 }) {
+    std::vector<PartitionID> partition;
+    for (size_t i = 0; i < 1000; ++i) {
+      partition.push_back((i * 7919) % k);
+    }
+    const PackedPartition packed_partition(partition, k);
+    ASSERT_EQ(packed_partition.size(), partition.size());
+    ASSERT_EQ(packed_partition.unpack(), partition);
+  }
+}
+
+TEST(APackedPartition, OverwritesBlockIDs) {
+  PackedPartition packed_partition(100, 5);
+  for (size_t i = 0; i < 100; ++i) {
+    packed_partition.set(i, 4);
+  }
+  packed_partition.set(21, 1);
+  ASSERT_EQ(packed_partition[20], 4);
+  ASSERT_EQ(packed_partition[21], 1);
+  ASSERT_EQ(packed_partition[22], 4);
+}
+
+TEST(APackedPartition, NeedsLessMemoryThanAnUnpackedPartition) {
+  const PackedPartition packed_partition(std::vector<PartitionID>(1024, 3), 4);
+  ASSERT_EQ(packed_partition.sizeInBytes(), 1024 * 2 / 8);
+}
+}  // namespace ds
+}  // namespace kahypar
@@ -20,6 +20,7 @@
 
 #include "gmock/gmock.h"
 
+#include "kahypar/datastructure/adaptive_gain_queue.h"
 #include "kahypar/datastructure/binary_heap.h"
 #include "kahypar/datastructure/bucket_queue.h"
 #include "kahypar/definitions.h"
@@ -32,6 +33,8 @@ namespace kahypar {
 namespace ds {
 using MaxHeapQueue = BinaryMaxHeap<HypernodeID, HyperedgeWeight>;
 using BucketQueue = EnhancedBucketQueue<HypernodeID, HyperedgeWeight>;
+using LinkedBucketPQ = LinkedBucketQueue<HypernodeID, HyperedgeWeight>;
+using AdaptivePQ = AdaptiveGainQueue<HypernodeID, HyperedgeWeight>;
 
 template <typename T>
 class APriorityQueue : public Test {
@@ -43,7 +46,7 @@ class APriorityQueue : public Test {
   T prio_queue;
 };
 
-typedef ::testing::Types<BucketQueue, MaxHeapQueue> Implementations;
+typedef ::testing::Types<BucketQueue, MaxHeapQueue, LinkedBucketPQ, AdaptivePQ> Implementations;
 
 TYPED_TEST_CASE(APriorityQueue, Implementations);
 
@@ -228,6 +231,59 @@ TEST(ABucketQueue, ChangesPositionOfElementsOnZeroGainUpdate) {
   ASSERT_THAT(bucket_pq.topKey(), Eq(10));
 }
 
+TEST(ALinkedBucketQueue, KeepsPositionOfElementsOnZeroGainUpdate) {
+  LinkedBucketPQ bucket_pq(10, 100);
+
+  bucket_pq.push(0, 10);
+  bucket_pq.push(2, 3);
+  bucket_pq.push(1, 10);
+
+  ASSERT_THAT(bucket_pq.top(), Eq(1));
+  bucket_pq.updateKey(0, 10);
+  ASSERT_THAT(bucket_pq.top(), Eq(1));
+  ASSERT_THAT(bucket_pq.topKey(), Eq(10));
+}
+
+TEST(ALinkedBucketQueue, KeepsExactKeysOutsideOfTheGainRange) {
+  LinkedBucketPQ bucket_pq(10, 5);
+
+  bucket_pq.push(0, 42);
+  bucket_pq.push(1, -17);
+  bucket_pq.push(2, 3);
+
+  ASSERT_THAT(bucket_pq.top(), Eq(0));
+  ASSERT_THAT(bucket_pq.topKey(), Eq(42));
+  ASSERT_THAT(bucket_pq.getKey(1), Eq(-17));
+  bucket_pq.updateKeyBy(0, -40);
+  ASSERT_THAT(bucket_pq.top(), Eq(2));
+  bucket_pq.pop();
+  bucket_pq.pop();
+  ASSERT_THAT(bucket_pq.top(), Eq(1));
+  ASSERT_THAT(bucket_pq.topKey(), Eq(-17));
+}
+
+TEST(ALinkedBucketQueue, LowersTheMaximumLazilyAfterRemovals) {
+  LinkedBucketPQ bucket_pq(10, 20);
+
+  bucket_pq.push(0, 20);
+  bucket_pq.push(1, -20);
+  bucket_pq.push(2, 7);
+  bucket_pq.remove(0);
+  ASSERT_THAT(bucket_pq.top(), Eq(2));
+  bucket_pq.updateKey(2, -20);
+  ASSERT_THAT(bucket_pq.topKey(), Eq(-20));
+  ASSERT_THAT(bucket_pq.size(), Eq(2));
+  bucket_pq.clear();
+  ASSERT_THAT(bucket_pq.empty(), Eq(true));
+  ASSERT_THAT(bucket_pq.contains(1), Eq(false));
+}
+
+TEST(AnAdaptiveGainQueue, UsesBucketsOnlyForSmallGainBounds) {
+  ASSERT_THAT(AdaptivePQ(10, 100).usesBuckets(), Eq(true));
+  ASSERT_THAT(AdaptivePQ(10, 0).usesBuckets(), Eq(false));
+  ASSERT_THAT(AdaptivePQ(10, AdaptivePQ::kMaxBucketGain + 1).usesBuckets(), Eq(false));
+}
+
 TYPED_TEST(APriorityQueue, IsSwappable) {
   // special type TypeParam is used to get current
   // implementation type
@@ -18,7 +18,10 @@
  *
  ******************************************************************************/
 
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "gmock/gmock.h"
 
@@ -91,4 +94,83 @@ TEST(KaHyPar, CanBeCalledViaInterface) {
 
   kahypar_context_free(context);
 }
+
+class PartitioningJob {
+ public:
+  explicit PartitioningJob(const size_t id) :
+    num_vertices(24 + 4 * id),
+    k(2 + id % 3),
+    hyperedge_indices({ 0 }),
+    hyperedges(),
+    hyperedge_weights(),
+    partition(num_vertices, -1),
+    objective(0) {
+    // ring of small hyperedges with some additional long-range hyperedges
+    for (kahypar_hypernode_id_t hn = 0; hn < num_vertices; ++hn) {
+      hyperedges.push_back(hn);
+      hyperedges.push_back((hn + 1) % num_vertices);
+      if (hn % 3 == 0) {
+        hyperedges.push_back((hn + 2 + id) % num_vertices);
+      }
+      hyperedge_indices.push_back(hyperedges.size());
+      hyperedge_weights.push_back(1 + (hn + id) % 4);
+    }
+  }
+
+  void run(kahypar_context_t* context) {
+    kahypar_partition(num_vertices, hyperedge_weights.size(), 0.03, k,
+                      /*vertex_weights */ nullptr, hyperedge_weights.data(),
+                      hyperedge_indices.data(), hyperedges.data(),
+                      &objective, context, partition.data());
+  }
+
+  const kahypar_hypernode_id_t num_vertices;
+  const kahypar_partition_id_t k;
+  std::vector<size_t> hyperedge_indices;
+  std::vector<kahypar_hyperedge_id_t> hyperedges;
+  std::vector<kahypar_hyperedge_weight_t> hyperedge_weights;
+  std::vector<kahypar_partition_id_t> partition;
+  kahypar_hyperedge_weight_t objective;
+};
+
+TEST(KaHyPar, CanBeCalledConcurrentlyViaInterface) {
+  kahypar_context_t* context = kahypar_context_new();
+  kahypar_configure_context_from_file(context, "../../../config/km1_direct_kway_sea18.ini");
+
+  const size_t num_jobs = 8;
+  const size_t num_threads = 4;
+
+  std::vector<PartitioningJob> sequential_jobs;
+  std::vector<PartitioningJob> concurrent_jobs;
+  for (size_t i = 0; i < num_jobs; ++i) {
+    sequential_jobs.emplace_back(i);
+    concurrent_jobs.emplace_back(i);
+  }
+
+  for (PartitioningJob& job : sequential_jobs) {
+    job.run(context);
+  }
+
+  // all threads share the same context
+  std::atomic<size_t> next_job(0);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&]() {
+        for (size_t job = next_job++; job < num_jobs; job = next_job++) {
+          concurrent_jobs[job].run(context);
+        }
+      });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < num_jobs; ++i) {
+    ASSERT_EQ(concurrent_jobs[i].objective, sequential_jobs[i].objective);
+    ASSERT_THAT(concurrent_jobs[i].partition,
+                ::testing::ContainerEq(sequential_jobs[i].partition));
+  }
+
+  kahypar_context_free(context);
+}
 }  // namespace kahypar
@@ -122,6 +122,50 @@ TEST_F(AHypergraphFileWithoutHyperedges, CanBeParsedIntoAHypergraphIfFileContain
   }
 }
 
+class AChunkedHGRParser : public ::testing::TestWithParam<std::string>{ };
+
+TEST_P(AChunkedHGRParser, ProducesTheSameResultAsTheSequentialParser) {
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  HyperedgeWeightVector hyperedge_weights;
+  HypernodeWeightVector hypernode_weights;
+  readHypergraphFile(GetParam(), num_hypernodes, num_hyperedges, index_vector, edge_vector,
+                     &hyperedge_weights, &hypernode_weights);
+
+  for (const size_t num_threads : { 1, 3 }) {
+    // small chunks to force splitting the file into many chunks
+    for (const size_t min_chunk_size : { static_cast<size_t>(1 << 20), static_cast<size_t>(5) }) {
+      HypernodeID parsed_num_hypernodes = 0;
+      HyperedgeID parsed_num_hyperedges = 0;
+      HyperedgeIndexVector parsed_index_vector;
+      HyperedgeVector parsed_edge_vector;
+      HyperedgeWeightVector parsed_hyperedge_weights;
+      HypernodeWeightVector parsed_hypernode_weights;
+      parseHypergraphFile(GetParam(), parsed_num_hypernodes, parsed_num_hyperedges,
+                          parsed_index_vector, parsed_edge_vector, &parsed_hyperedge_weights,
+                          &parsed_hypernode_weights, num_threads, min_chunk_size);
+
+      ASSERT_THAT(parsed_num_hypernodes, Eq(num_hypernodes));
+      ASSERT_THAT(parsed_num_hyperedges, Eq(num_hyperedges));
+      ASSERT_THAT(parsed_index_vector, ContainerEq(index_vector));
+      ASSERT_THAT(parsed_edge_vector, ContainerEq(edge_vector));
+      ASSERT_THAT(parsed_hyperedge_weights, ContainerEq(hyperedge_weights));
+      ASSERT_THAT(parsed_hypernode_weights, ContainerEq(hypernode_weights));
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(HGRFiles,
+                        AChunkedHGRParser,
+                        ::testing::Values("test_instances/unweighted_hypergraph.hgr",
+                                          "test_instances/weighted_hyperedges_hypergraph.hgr",
+                                          "test_instances/weighted_hypernodes_hypergraph.hgr",
+                                          "test_instances/weighted_hyperedges_and_hypernodes_hypergraph.hgr",
+                                          "test_instances/hypergraph_without_hyperedges.hgr",
+                                          "test_instances/star_like_structure.hgr"));
+
 TEST(AHypergraphWithoutHyperedges, CanBeWrittenToFile) {
   HypernodeID num_hypernodes = 0;
   HyperedgeID num_hyperedges = 0;
@@ -197,6 +241,34 @@ TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, CanBeWrittenToFile) {
   ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
 }
 
+TEST_F(AnUnweightedHypergraph, CanBeWrittenToBinaryFile) {
+  writeBinaryHypergraphFile(*_hypergraph, _filename);
+
+  ASSERT_THAT(isBinaryHypergraphFile(_filename), Eq(true));
+  Hypergraph hypergraph2(createHypergraphFromBinaryFile(_filename, 2));
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+}
+
+TEST_F(AHypergraphWithHypernodeAndHyperedgeWeights, CanBeWrittenToBinaryFile) {
+  writeBinaryHypergraphFile(*_hypergraph, _filename);
+
+  ASSERT_THAT(isBinaryHypergraphFile(_filename), Eq(true));
+  Hypergraph hypergraph2(createHypergraphFromBinaryFile(_filename, 2));
+  ASSERT_THAT(hypergraph2.type(), Eq(HypergraphType::EdgeAndNodeWeights));
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+}
+
+TEST_F(AHypergraphWithHyperedgeWeights, IsDetectedAsBinaryFileWhenReadFromFile) {
+  writeBinaryHypergraphFile(*_hypergraph, _filename);
+
+  Hypergraph hypergraph2(createHypergraphFromFile(_filename, 2));
+  ASSERT_THAT(verifyEquivalenceWithPartitionInfo(*_hypergraph, hypergraph2), Eq(true));
+}
+
+TEST(AHGRFile, IsNotDetectedAsBinaryFile) {
+  ASSERT_THAT(isBinaryHypergraphFile("test_instances/unweighted_hypergraph.hgr"), Eq(false));
+}
+
 TEST_F(APartitionOfAHypergraph, IsCorrectlyWrittenToFile) {
   multilevel::partition(_hypergraph, *_coarsener, *_refiner, _context);
   writePartitionFile(_hypergraph, _context.partition.graph_partition_filename);
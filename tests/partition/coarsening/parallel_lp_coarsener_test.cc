@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/coarsening/parallel_lp_coarsener.h"
+#include "kahypar/partition/coarsening/policies/fixed_vertex_acceptance_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/2way_fm_refiner.h"
+#include "kahypar/partition/refinement/do_nothing_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+
+using ::testing::Eq;
+using ::testing::Le;
+using ::testing::Test;
+
+namespace kahypar {
+using CoarsenerType = ParallelLPCoarsener<HeavyEdgeScore,
+                                          MultiplicativePenalty,
+                                          UseCommunityStructure,
+                                          NormalPartitionPolicy,
+                                          BestRatingWithTieBreaking<RandomRatingWins>,
+                                          AllowFreeOnFixedFreeOnFreeFixedOnFixed,
+                                          RatingType>;
+
+class AParallelLPCoarsener : public Test {
+ public:
+  AParallelLPCoarsener() :
+    hypergraph(io::createHypergraphFromFile(
+                 "../../../../tests/partition/initial_partitioning/test_instances/test_instance.hgr",
+                 2)),
+    context() {
+    context.partition.k = 2;
+    context.partition.objective = Objective::cut;
+    context.partition.epsilon = 0.03;
+    context.partition.perfect_balance_part_weights.push_back(
+      ceil(hypergraph.totalWeight() / 2.0));
+    context.partition.perfect_balance_part_weights.push_back(
+      ceil(hypergraph.totalWeight() / 2.0));
+    context.partition.max_part_weights.push_back((1 + context.partition.epsilon)
+                                                 * context.partition.perfect_balance_part_weights[0]);
+    context.partition.max_part_weights.push_back((1 + context.partition.epsilon)
+                                                 * context.partition.perfect_balance_part_weights[1]);
+    context.coarsening.max_allowed_node_weight = 10;
+    Randomize::instance().setSeed(context.partition.seed);
+  }
+
+  std::vector<HypernodeWeight> coarsenedNodeWeights(const size_t num_threads) {
+    Hypergraph copy(io::createHypergraphFromFile(
+                      "../../../../tests/partition/initial_partitioning/test_instances/test_instance.hgr",
+                      2));
+    Context current_context(context);
+    current_context.partition.num_threads = num_threads;
+    Randomize::instance().setSeed(context.partition.seed);
+    CoarsenerType coarsener(copy, current_context,  /* heaviest_node_weight */ 1);
+    coarsener.coarsen(25);
+
+    std::vector<HypernodeWeight> node_weights(copy.initialNumNodes(), 0);
+    for (const HypernodeID& hn : copy.nodes()) {
+      node_weights[hn] = copy.nodeWeight(hn);
+    }
+    return node_weights;
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+};
+
+TEST_F(AParallelLPCoarsener, CoarsensUntilContractionLimit) {
+  context.partition.num_threads = 4;
+  CoarsenerType coarsener(hypergraph, context,  /* heaviest_node_weight */ 1);
+  coarsener.coarsen(25);
+  ASSERT_THAT(hypergraph.currentNumNodes(), Eq(25));
+}
+
+TEST_F(AParallelLPCoarsener, RespectsMaximumAllowedNodeWeight) {
+  context.partition.num_threads = 4;
+  context.coarsening.max_allowed_node_weight = 3;
+  CoarsenerType coarsener(hypergraph, context,  /* heaviest_node_weight */ 1);
+  coarsener.coarsen(2);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_THAT(hypergraph.nodeWeight(hn), Le(3));
+  }
+}
+
+TEST_F(AParallelLPCoarsener, RestoresOriginalHypergraphDuringUncoarsening) {
+  std::vector<HypernodeID> edge_sizes;
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    edge_sizes.push_back(hypergraph.edgeSize(he));
+  }
+
+  context.partition.num_threads = 2;
+  CoarsenerType coarsener(hypergraph, context,  /* heaviest_node_weight */ 1);
+  coarsener.coarsen(25);
+  PartitionID part = 0;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, part);
+    part = 1 - part;
+  }
+  hypergraph.initializeNumCutHyperedges();
+
+  std::unique_ptr<IRefiner> refiner(new DoNothingRefiner());
+  refiner->initialize(999999);
+  coarsener.uncoarsen(*refiner);
+
+  ASSERT_THAT(hypergraph.currentNumNodes(), Eq(hypergraph.initialNumNodes()));
+  ASSERT_THAT(hypergraph.currentNumEdges(), Eq(hypergraph.initialNumEdges()));
+  ASSERT_THAT(hypergraph.currentNumPins(), Eq(hypergraph.initialNumPins()));
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    ASSERT_THAT(hypergraph.edgeSize(he), Eq(edge_sizes[he]));
+  }
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_THAT(hypergraph.nodeWeight(hn), Eq(1));
+  }
+}
+
+TEST_F(AParallelLPCoarsener, UncontractsBatchesOfIndependentContractions) {
+  context.local_search.algorithm = RefinementAlgorithm::twoway_fm;
+  context.local_search.fm.max_number_of_fruitless_moves = 50;
+  context.local_search.uncontraction_batch_size = 8;
+  CoarsenerType coarsener(hypergraph, context,  /* heaviest_node_weight */ 1);
+  coarsener.coarsen(25);
+  PartitionID part = 0;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, part);
+    part = 1 - part;
+  }
+  hypergraph.initializeNumCutHyperedges();
+  const HyperedgeWeight initial_cut = metrics::hyperedgeCut(hypergraph);
+
+  std::unique_ptr<IRefiner> refiner(
+    new TwoWayFMRefiner<NumberOfFruitlessMovesStopsSearch>(hypergraph, context));
+  coarsener.uncoarsen(*refiner);
+
+  ASSERT_THAT(hypergraph.currentNumNodes(), Eq(hypergraph.initialNumNodes()));
+  ASSERT_THAT(hypergraph.currentNumPins(), Eq(hypergraph.initialNumPins()));
+  ASSERT_THAT(metrics::hyperedgeCut(hypergraph), Le(initial_cut));
+}
+
+TEST_F(AParallelLPCoarsener, IsIndependentOfTheNumberOfThreads) {
+  ASSERT_THAT(coarsenedNodeWeights(1), Eq(coarsenedNodeWeights(3)));
+}
+}  // namespace kahypar
@@ -118,4 +118,57 @@ TEST_F(TheEvoPartitioner, RespectsTheTimeLimit) {
   ASSERT_GT(total_time, context.partition.time_limit);
   ASSERT_LT(total_time - times.at(times.size() - 1), context.partition.time_limit);
 }
+
+TEST_F(TheEvoPartitioner, ExchangesMigrantsBetweenIslands) {
+  context.partition.quiet_mode = true;
+  context.evolutionary.dynamic_population_size = false;
+  context.evolutionary.population_size = 3;
+  Migration migration(2, EvoMigrationTopology::ring);
+
+  EvoPartitioner first_island(context);
+  first_island._island = 0;
+  first_island._migration = &migration;
+  EvoPartitioner second_island(context);
+  second_island._island = 1;
+  second_island._migration = &migration;
+
+  Randomize::instance().setSeed(1);
+  first_island.generateInitialPopulation(hypergraph, context);
+  Randomize::instance().setSeed(2);
+  second_island.generateInitialPopulation(hypergraph, context);
+
+  const std::vector<PartitionID> emigrant =
+    first_island._population.individualAt(first_island._population.best()).partition();
+  first_island.migrate(hypergraph, context);
+  second_island.migrate(hypergraph, context);
+
+  bool contains_emigrant = false;
+  for (size_t i = 0; i < second_island._population.size(); ++i) {
+    contains_emigrant |= second_island._population.individualAt(i).partition() == emigrant;
+  }
+  ASSERT_TRUE(contains_emigrant);
+  ASSERT_TRUE(migration.immigrate(1).empty());
+  // The best individual of the first island did not change and therefore does not
+  // emigrate again.
+  first_island.migrate(hypergraph, context);
+  ASSERT_TRUE(migration.immigrate(1).empty());
+}
+
+TEST_F(TheEvoPartitioner, ComputesABalancedPartitionUsingMultipleIslands) {
+  context.partition.quiet_mode = true;
+  context.partition.time_limit = 1;
+  context.partition.num_threads = 2;
+  context.evolutionary.dynamic_population_size = false;
+  context.evolutionary.population_size = 3;
+  context.evolutionary.migration_interval = 1;
+
+  EvoPartitioner evo_part(context);
+  evo_part.partition(hypergraph, context);
+
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_NE(hypergraph.partID(hn), Hypergraph::kInvalidPartition);
+  }
+  ASSERT_EQ(metrics::correctMetric(hypergraph, context), evo_part._population.bestFitness());
+  ASSERT_LE(metrics::imbalance(hypergraph, context), context.partition.epsilon);
+}
 }  // namespace kahypar
@@ -18,6 +18,8 @@
  * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
  *
 ******************************************************************************/
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 #include "gmock/gmock.h"
@@ -84,4 +86,45 @@ TEST_F(AnIndividual, IsCorrectlyExtractedFromTheHypergraphForCut) {
   ASSERT_EQ(individual.strongCutEdges()[2], 1);
   ASSERT_EQ(individual.fitness(), 2);
 }
+
+TEST_F(AnIndividual, ComputesTheSymmetricDifferencesOfTheCutEdgesOfTwoIndividuals) {
+  Context context;
+  context.partition.objective = Objective::km1;
+  std::vector<Individual> individuals;
+  std::vector<std::vector<HyperedgeID> > cut_edges;
+  std::vector<std::vector<HyperedgeID> > strong_cut_edges;
+  for (PartitionID p = 0; p < 256; ++p) {
+    hypergraph.reset();
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, (p >> (2 * hn)) & 3);
+    }
+    individuals.emplace_back(hypergraph, context);
+    cut_edges.emplace_back();
+    strong_cut_edges.emplace_back();
+    for (const HyperedgeID& he : hypergraph.edges()) {
+      if (hypergraph.connectivity(he) > 1) {
+        cut_edges.back().push_back(he);
+      }
+      for (PartitionID i = 1; i < hypergraph.connectivity(he); ++i) {
+        strong_cut_edges.back().push_back(he);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < individuals.size(); ++i) {
+    for (size_t j = 0; j < individuals.size(); ++j) {
+      std::vector<HyperedgeID> difference;
+      std::set_symmetric_difference(cut_edges[i].begin(), cut_edges[i].end(),
+                                    cut_edges[j].begin(), cut_edges[j].end(),
+                                    std::back_inserter(difference));
+      ASSERT_EQ(individuals[i].cutEdgeDifference(individuals[j]), difference.size());
+
+      difference.clear();
+      std::set_symmetric_difference(strong_cut_edges[i].begin(), strong_cut_edges[i].end(),
+                                    strong_cut_edges[j].begin(), strong_cut_edges[j].end(),
+                                    std::back_inserter(difference));
+      ASSERT_EQ(individuals[i].strongCutEdgeDifference(individuals[j]), difference.size());
+    }
+  }
+}
 }  // namespace kahypar
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/partition/evolutionary/migration.h"
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+TEST(AMigration, SendsMigrantsToTheNextIslandOfTheRing) {
+  Migration migration(4, EvoMigrationTopology::ring);
+  ASSERT_THAT(migration.targets(0), ElementsAre(1));
+  ASSERT_THAT(migration.targets(3), ElementsAre(0));
+}
+
+TEST(AMigration, SendsMigrantsToAllOtherIslandsInACompleteTopology) {
+  Migration migration(4, EvoMigrationTopology::complete);
+  ASSERT_THAT(migration.targets(2), ElementsAre(0, 1, 3));
+}
+
+TEST(AMigration, NeverSendsMigrantsOfARandomTopologyToTheSendingIsland) {
+  Migration migration(3, EvoMigrationTopology::random);
+  Randomize::instance().setSeed(1);
+  for (size_t i = 0; i < 100; ++i) {
+    const std::vector<size_t> targets = migration.targets(1);
+    ASSERT_EQ(targets.size(), 1);
+    ASSERT_NE(targets[0], 1);
+  }
+}
+
+TEST(AMigration, DoesNotSendMigrantsIfThereIsOnlyOneIsland) {
+  Migration migration(1, EvoMigrationTopology::complete);
+  migration.emigrate(0, { 0, 1 });
+  ASSERT_TRUE(migration.immigrate(0).empty());
+}
+
+TEST(AMigration, KeepsOnlyTheNewestMigrantOfEachSendingIsland) {
+  Migration migration(3, EvoMigrationTopology::complete);
+  migration.emigrate(0, { 0, 0, 1 });
+  migration.emigrate(2, { 1, 1, 0 });
+  migration.emigrate(0, { 0, 1, 1 });
+
+  const std::vector<Migration::Migrant> migrants = migration.immigrate(1);
+  ASSERT_THAT(migrants, ElementsAre(ElementsAre(0, 1, 1), ElementsAre(1, 1, 0)));
+  ASSERT_TRUE(migration.immigrate(1).empty());
+}
+}  // namespace kahypar
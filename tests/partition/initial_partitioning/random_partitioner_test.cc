@@ -230,4 +230,42 @@ TEST_F(AKWayRandomInitialPartitionerTest, SetCorrectFixedVertexPart) {
     ASSERT_EQ(hypergraph->partID(hn), hypergraph->fixedVertexPartID(hn));
   }
 }
+
+TEST_F(AKWayRandomInitialPartitionerTest, ExecutesMultipleRunsInParallel) {
+  PartitionID k = 4;
+  initializePartitioning(k);
+  generateRandomFixedVertices(*hypergraph, 0.1, 4);
+  context.partition.num_threads = 3;
+  Randomize::instance().setSeed(42);
+  partitioner->partition();
+
+  ASSERT_LE(metrics::imbalance(*hypergraph, context),
+            context.partition.epsilon);
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    ASSERT_NE(hypergraph->partID(hn), -1);
+  }
+  for (const HypernodeID& hn : hypergraph->fixedVertices()) {
+    ASSERT_EQ(hypergraph->partID(hn), hypergraph->fixedVertexPartID(hn));
+  }
+}
+
+TEST_F(AKWayRandomInitialPartitionerTest, IsIndependentOfTheNumberOfThreads) {
+  PartitionID k = 4;
+  initializePartitioning(k);
+  context.partition.num_threads = 2;
+  Randomize::instance().setSeed(42);
+  partitioner->partition();
+  std::vector<PartitionID> partition;
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    partition.push_back(hypergraph->partID(hn));
+  }
+
+  hypergraph->resetPartitioning();
+  context.partition.num_threads = 4;
+  Randomize::instance().setSeed(42);
+  partitioner->partition();
+  for (const HypernodeID& hn : hypergraph->nodes()) {
+    ASSERT_EQ(hypergraph->partID(hn), partition[hn]);
+  }
+}
 }  // namespace kahypar
@@ -19,6 +19,7 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
 #include <fstream>
 #include <set>
 #include <vector>
@@ -216,6 +217,74 @@ TEST(ALouvainKarateClub, DoesLouvainAlgorithm) {
   }
 }
 
+TEST(Louvain, ComputesTheSameCommunitiesIndependentOfTheNumberOfThreads) {
+  Context context;
+  context.partition.k = 2;
+  context.preprocessing.community_detection.max_pass_iterations = 100;
+  context.preprocessing.community_detection.min_eps_improvement = 0.0001;
+  context.preprocessing.community_detection.edge_weight = LouvainEdgeWeight::degree;
+
+  // random hypergraph whose nodes span several chunks of the parallel local moving phase
+  Randomize::instance().setSeed(42);
+  const HypernodeID num_hypernodes = 1500;
+  const HyperedgeID num_hyperedges = 1800;
+  HyperedgeIndexVector index_vector = { 0 };
+  HyperedgeVector edge_vector;
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    const HypernodeID first_pin = Randomize::instance().getRandomInt(0, num_hypernodes - 1);
+    const int size = Randomize::instance().getRandomInt(2, 4);
+    for (int i = 0; i < size; ++i) {
+      // pins are local to a neighborhood of the first pin to induce communities
+      edge_vector.push_back((first_pin + i * Randomize::instance().getRandomInt(1, 10)) %
+                            num_hypernodes);
+    }
+    std::sort(edge_vector.begin() + index_vector.back(), edge_vector.end());
+    edge_vector.erase(std::unique(edge_vector.begin() + index_vector.back(), edge_vector.end()),
+                      edge_vector.end());
+    index_vector.push_back(edge_vector.size());
+  }
+  Hypergraph hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector);
+
+  std::vector<std::vector<ClusterID> > communities;
+  std::vector<EdgeWeight> modularity;
+  for (const size_t num_threads : { 2, 4 }) {
+    context.partition.num_threads = num_threads;
+    Louvain<Modularity, false> louvain(hypergraph, context);
+    modularity.push_back(louvain.run());
+    communities.emplace_back();
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      communities.back().push_back(louvain.clusterID(hn));
+    }
+  }
+
+  ASSERT_GT(modularity[0], 0.0L);
+  ASSERT_EQ(modularity[0], modularity[1]);
+  ASSERT_THAT(communities[0], ::testing::ContainerEq(communities[1]));
+}
+
+TEST(Louvain, ComputesCommunitiesOfComparableQualityInParallel) {
+  Context context;
+  context.partition.k = 2;
+  context.partition.graph_filename = "test_instances/karate_club.graph.hgr";
+  context.preprocessing.community_detection.max_pass_iterations = 100;
+  context.preprocessing.community_detection.min_eps_improvement = 0.0001;
+  context.preprocessing.community_detection.edge_weight = LouvainEdgeWeight::uniform;
+
+  Hypergraph hypergraph(
+    io::createHypergraphFromFile(context.partition.graph_filename,
+                                 context.partition.k));
+
+  Louvain<Modularity, false> sequential_louvain(hypergraph, context);
+  const EdgeWeight sequential_modularity = sequential_louvain.run();
+
+  context.partition.num_threads = 2;
+  Louvain<Modularity, false> parallel_louvain(hypergraph, context);
+  const EdgeWeight parallel_modularity = parallel_louvain.run();
+
+  ASSERT_GT(parallel_modularity, 0.9 * sequential_modularity);
+  ASSERT_GE(parallel_louvain.numCommunities(), 2);
+}
+
 TEST(Louvain, WorksOnGraphDSThatChangesHypergraphIntoGraph) {
   Context context;
 
@@ -18,13 +18,18 @@
  *
  ******************************************************************************/
 
+#include <algorithm>
+#include <vector>
+
 #include "gmock/gmock.h"
 
 #include "kahypar/definitions.h"
 #include "kahypar/io/hypergraph_io.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/preprocessing/min_hash_sparsifier.h"
+#include "kahypar/utils/randomize.h"
 
+using ::testing::ContainerEq;
 using ::testing::Eq;
 
 namespace kahypar {
@@ -54,4 +59,48 @@ TEST(TheLSHSparsifier, HandlesWeightedNodesAndEdges) {
   ASSERT_EQ(sparse_hypergraph.nodeWeight(4), 50);
   ASSERT_EQ(sparse_hypergraph.nodeWeight(5), 50);
 }
+
+TEST(TheLSHSparsifier, ComputesTheSameClusteringIndependentOfTheNumberOfThreads) {
+  // random hypergraph with large hyperedges whose vertices span several chunks
+  Randomize::instance().setSeed(42);
+  const HypernodeID num_hypernodes = 3000;
+  const HyperedgeID num_hyperedges = 1000;
+  HyperedgeIndexVector index_vector = { 0 };
+  HyperedgeVector edge_vector;
+  for (HyperedgeID he = 0; he < num_hyperedges; ++he) {
+    const HypernodeID first_pin = Randomize::instance().getRandomInt(0, num_hypernodes - 1);
+    const int size = Randomize::instance().getRandomInt(2, 40);
+    for (int i = 0; i < size; ++i) {
+      edge_vector.push_back((first_pin + i) % num_hypernodes);
+    }
+    std::sort(edge_vector.begin() + index_vector.back(), edge_vector.end());
+    index_vector.push_back(edge_vector.size());
+  }
+  Hypergraph hypergraph(num_hypernodes, num_hyperedges, index_vector, edge_vector);
+
+  Context context;
+  context.partition.k = 2;
+  context.partition.quiet_mode = true;
+  context.preprocessing.enable_min_hash_sparsifier = true;
+  context.preprocessing.min_hash_sparsifier.max_hyperedge_size = 1200;
+  context.preprocessing.min_hash_sparsifier.max_cluster_size = 10;
+  context.preprocessing.min_hash_sparsifier.min_cluster_size = 2;
+  context.preprocessing.min_hash_sparsifier.num_hash_functions = 5;
+  context.preprocessing.min_hash_sparsifier.combined_num_hash_functions = 100;
+
+  MinHashSparsifier sequential_sparsifier;
+  const Hypergraph sequential_hypergraph =
+    sequential_sparsifier.buildSparsifiedHypergraph(hypergraph, context);
+
+  context.partition.num_threads = 4;
+  MinHashSparsifier parallel_sparsifier;
+  const Hypergraph parallel_hypergraph =
+    parallel_sparsifier.buildSparsifiedHypergraph(hypergraph, context);
+
+  ASSERT_LT(sequential_hypergraph.currentNumNodes(), hypergraph.currentNumNodes());
+  ASSERT_EQ(sequential_hypergraph.currentNumNodes(), parallel_hypergraph.currentNumNodes());
+  ASSERT_EQ(sequential_hypergraph.currentNumEdges(), parallel_hypergraph.currentNumEdges());
+  ASSERT_THAT(parallel_sparsifier.hnToSparsifiedHnMapping(),
+              ContainerEq(sequential_sparsifier.hnToSparsifiedHnMapping()));
+}
 }  // namespace kahypar
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/application/command_line_options.h"
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partitioner_facade.h"
+
+using ::testing::Eq;
+using ::testing::Le;
+using ::testing::Test;
+
+namespace kahypar {
+class AParallelRecursiveBisection : public Test {
+ public:
+  AParallelRecursiveBisection() :
+    context() {
+    parseIniToContext(context, "../../../config/cut_rb_alenex16.ini");
+    context.partition.k = 4;
+    context.partition.epsilon = 0.1;
+    context.partition.seed = 42;
+    context.partition.quiet_mode = true;
+    context.partition.write_partition_file = false;
+    context.partition.graph_filename =
+      "../../../tests/partition/initial_partitioning/test_instances/test_instance.hgr";
+  }
+
+  std::vector<PartitionID> partition(const size_t num_threads) {
+    Context current_context(context);
+    current_context.partition.num_threads = num_threads;
+    Hypergraph hypergraph(io::createHypergraphFromFile(current_context.partition.graph_filename,
+                                                       current_context.partition.k));
+    PartitionerFacade().partition(hypergraph, current_context);
+
+    EXPECT_THAT(metrics::imbalance(hypergraph, current_context),
+                Le(current_context.partition.epsilon));
+    std::vector<PartitionID> result;
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      result.push_back(hypergraph.partID(hn));
+    }
+    return result;
+  }
+
+  Context context;
+};
+
+TEST_F(AParallelRecursiveBisection, ComputesBalancedPartitions) {
+  const std::vector<PartitionID> result = partition(4);
+  for (const PartitionID part : result) {
+    ASSERT_THAT(part >= 0 && part < context.partition.k, Eq(true));
+  }
+}
+
+TEST_F(AParallelRecursiveBisection, IsDeterministicForAGivenSeed) {
+  ASSERT_THAT(partition(4), Eq(partition(4)));
+}
+
+TEST_F(AParallelRecursiveBisection, IsIndependentOfTheNumberOfThreads) {
+  ASSERT_THAT(partition(2), Eq(partition(3)));
+}
+}  // namespace kahypar
@@ -130,6 +130,7 @@ INSTANTIATE_TEST_CASE_P(FlowAlgorithmRefinerTest,
                         TwoWayFlowRefinerTest,
                         ::testing::Values(FlowAlgorithm::edmond_karp,
                                           FlowAlgorithm::goldberg_tarjan,
+                                          FlowAlgorithm::parallel_push_relabel,
                                           FlowAlgorithm::boykov_kolmogorov,
                                           FlowAlgorithm::ibfs));
 
@@ -144,4 +145,11 @@ TEST_P(TwoWayFlowRefinerTest, CutObjective) {
   context.local_search.flow.algorithm = GetParam();
   testRefiner();
 }
+
+TEST_P(TwoWayFlowRefinerTest, Km1ObjectiveWithWarmStart) {
+  context.partition.objective = Objective::km1;
+  context.local_search.flow.algorithm = GetParam();
+  context.local_search.flow.use_warm_start = true;
+  testRefiner();
+}
 }  // namespace kahypar
@@ -136,6 +136,7 @@ INSTANTIATE_TEST_CASE_P(FlowAlgorithmRefinerTest,
                         KWayFlowRefinerTest,
                         ::testing::Values(FlowAlgorithm::edmond_karp,
                                           FlowAlgorithm::goldberg_tarjan,
+                                          FlowAlgorithm::parallel_push_relabel,
                                           FlowAlgorithm::boykov_kolmogorov,
                                           FlowAlgorithm::ibfs));
 
@@ -150,4 +151,11 @@ TEST_P(KWayFlowRefinerTest, CutObjective) {
   context.local_search.flow.algorithm = GetParam();
   testRefiner();
 }
+
+TEST_P(KWayFlowRefinerTest, Km1ObjectiveWithMultipleThreads) {
+  context.partition.objective = Objective::km1;
+  context.partition.num_threads = 2;
+  context.local_search.flow.algorithm = GetParam();
+  testRefiner();
+}
 }  // namespace kahypar
@@ -23,6 +23,7 @@
 #include "gmock/gmock.h"
 
 #include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/flow/maximum_flow.h"
 
@@ -77,6 +78,9 @@ using MaxFlowEdmondKarp = MaximumFlowTemplateStruct<Network, EdmondKarp<Network>
 template <class Network>
 using MaxFlowGoldbergTarjan = MaximumFlowTemplateStruct<Network, GoldbergTarjan<Network> >;
 
+template <class Network>
+using MaxFlowParallelPushRelabel = MaximumFlowTemplateStruct<Network, ParallelPushRelabel<Network> >;
+
 template <class Network>
 using MaxFlowBoykovKolmogorov = MaximumFlowTemplateStruct<Network, BoykovKolmogorov<Network> >;
 
@@ -91,6 +95,10 @@ typedef ::testing::Types<MaxFlowEdmondKarp<LawlerNetwork>,
                          MaxFlowGoldbergTarjan<HeuerNetwork>,
                          MaxFlowGoldbergTarjan<WongNetwork>,
                          MaxFlowGoldbergTarjan<HybridNetwork>,
+                         MaxFlowParallelPushRelabel<LawlerNetwork>,
+                         MaxFlowParallelPushRelabel<HeuerNetwork>,
+                         MaxFlowParallelPushRelabel<WongNetwork>,
+                         MaxFlowParallelPushRelabel<HybridNetwork>,
                          MaxFlowBoykovKolmogorov<LawlerNetwork>,
                          MaxFlowBoykovKolmogorov<HeuerNetwork>,
                          MaxFlowBoykovKolmogorov<WongNetwork>,
@@ -171,4 +179,88 @@ TYPED_TEST(AMaximumFlow, RollbackAfterMinimumSTCut) {
     ASSERT_EQ(part_after[hn], this->hypergraph.partID(hn));
   }
 }
+
+TYPED_TEST(AMaximumFlow, RestoresTheStoredFlowOfThePreviousFlowProblem) {
+  this->setupFlowNetwork();
+  Flow f = this->maximumFlow.maximumFlow();
+  ASSERT_EQ(f, 2);
+  this->flowNetwork.storeFlow();
+
+  this->flowNetwork.reset();
+  this->hypergraph.resetPartitioning();
+  this->setupFlowNetwork();
+  ASSERT_EQ(this->flowNetwork.restoreFlow(), 2);
+  ASSERT_EQ(this->maximumFlow.maximumFlow(), 0);
+}
+
+TYPED_TEST(AMaximumFlow, RepairsTheStoredFlowIfTheFlowProblemChanged) {
+  // Hypernodes 2, 3 and 4 are not part of the smaller flow problem
+  const auto setup_smaller_flow_network = [&]() {
+                                            this->flowNetwork.reset();
+                                            this->hypergraph.resetPartitioning();
+                                            std::vector<PartitionID> part = { 0, 1, 0, 1, 0, 1, 1, 1, 1, 0 };
+                                            for (const HypernodeID& hn : this->hypergraph.nodes()) {
+                                              this->hypergraph.setNodePart(hn, part[hn]);
+                                            }
+                                            for (HypernodeID node = 5; node <= 7; ++node) {
+                                              this->flowNetwork.addHypernode(node);
+                                            }
+                                            this->flowNetwork.build(0, 1);
+                                          };
+  setup_smaller_flow_network();
+  const Flow expected_flow = this->maximumFlow.maximumFlow();
+
+  this->flowNetwork.reset();
+  this->hypergraph.resetPartitioning();
+  this->setupFlowNetwork();
+  ASSERT_EQ(this->maximumFlow.maximumFlow(), 2);
+  this->flowNetwork.storeFlow();
+
+  setup_smaller_flow_network();
+  const Flow initial_flow = this->flowNetwork.restoreFlow();
+  ASSERT_LE(initial_flow, expected_flow);
+  ASSERT_EQ(initial_flow + this->maximumFlow.maximumFlow(), expected_flow);
+}
+
+TYPED_TEST(AMaximumFlow, FindsTheSameMinimumSTCutWithWarmStart) {
+  this->context.local_search.flow.use_most_balanced_minimum_cut = false;
+  this->setupFlowNetwork();
+  HyperedgeWeight cut = this->maximumFlow.minimumSTCut(0, 1);
+  this->maximumFlow.rollback(true);
+  this->flowNetwork.storeFlow();
+
+  this->flowNetwork.reset();
+  this->hypergraph.resetPartitioning();
+  this->setupFlowNetwork();
+  ASSERT_EQ(this->maximumFlow.minimumSTCut(0, 1), cut);
+  ASSERT_EQ(metrics::hyperedgeCut(this->hypergraph), cut);
+}
+
+TEST(AParallelPushRelabel, ComputesTheSameMaximumFlowAsIBFSInParallel) {
+  Context context;
+  Hypergraph hypergraph(io::createHypergraphFromFile("test_instances/ibm01.hgr", 2));
+  HybridNetwork flow_network(hypergraph, context);
+  const auto setup_flow_network = [&]() {
+                                    flow_network.reset();
+                                    hypergraph.resetPartitioning();
+                                    for (const HypernodeID& hn : hypergraph.nodes()) {
+                                      hypergraph.setNodePart(hn, hn % 2);
+                                    }
+                                    for (const HypernodeID& hn : hypergraph.nodes()) {
+                                      if (hn % 4 != 0) {
+                                        flow_network.addHypernode(hn);
+                                      }
+                                    }
+                                    flow_network.build(0, 1);
+                                  };
+
+  IBFS<HybridNetwork> ibfs(hypergraph, context, flow_network);
+  setup_flow_network();
+  const Flow expected_flow = ibfs.maximumFlow();
+
+  context.partition.num_threads = 4;
+  ParallelPushRelabel<HybridNetwork> push_relabel(hypergraph, context, flow_network);
+  setup_flow_network();
+  ASSERT_EQ(push_relabel.maximumFlow(), expected_flow);
+}
 }  // namespace kahypar
@@ -26,6 +26,7 @@
 #include "kahypar/io/hypergraph_io.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/flow/maximum_flow.h"
+#include "kahypar/utils/randomize.h"
 
 using ::testing::Test;
 using ::testing::Eq;
@@ -137,4 +138,66 @@ TEST_F(MostBalancedMinimumCutTest, WithPerfectBalancedBipartition) {
   ASSERT_EQ(cut, 2);
   ASSERT_EQ(metrics::imbalance(*hypergraph, context), 0);
 }
+
+/**
+ * Ladder with num_columns columns:
+ * 0 - 2 - 4 - ...
+ * |   |   |
+ * 1 - 3 - 5 - ...
+ */
+static Hypergraph ladder(const HypernodeID num_columns) {
+  HyperedgeIndexVector index_vector = { 0 };
+  HyperedgeVector edge_vector;
+  const auto add_edge = [&](const HypernodeID u, const HypernodeID v) {
+                          edge_vector.push_back(u);
+                          edge_vector.push_back(v);
+                          index_vector.push_back(edge_vector.size());
+                        };
+  for (HypernodeID column = 0; column < num_columns; ++column) {
+    add_edge(2 * column, 2 * column + 1);
+    if (column + 1 < num_columns) {
+      add_edge(2 * column, 2 * column + 2);
+      add_edge(2 * column + 1, 2 * column + 3);
+    }
+  }
+  return Hypergraph(2 * num_columns, index_vector.size() - 1, index_vector, edge_vector, 2);
+}
+
+static std::vector<PartitionID> mostBalancedMinimumCutOfLadder(const size_t num_threads) {
+  const HypernodeID num_columns = 1500;
+  Hypergraph hypergraph(ladder(num_columns));
+  Context context;
+  context.partition.k = 2;
+  context.partition.epsilon = 0.00;
+  context.partition.objective = Objective::km1;
+  context.partition.perfect_balance_part_weights = { num_columns, num_columns };
+  context.partition.max_part_weights = { num_columns, num_columns };
+  context.partition.num_threads = num_threads;
+  context.local_search.flow.use_most_balanced_minimum_cut = true;
+
+  // All columns except the first and the last one are part of the flow problem
+  LawlerNetwork flow_network(hypergraph, context);
+  IBFS<LawlerNetwork> maximum_flow(hypergraph, context, flow_network);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, hn < 20 ? 0 : 1);
+  }
+  for (HypernodeID hn = 2; hn < 2 * num_columns - 2; ++hn) {
+    flow_network.addHypernode(hn);
+  }
+  flow_network.build(0, 1);
+
+  Randomize::instance().setSeed(0);
+  EXPECT_EQ(maximum_flow.minimumSTCut(0, 1), 2);
+  EXPECT_EQ(metrics::imbalance(hypergraph, context), 0);
+
+  std::vector<PartitionID> partition;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    partition.push_back(hypergraph.partID(hn));
+  }
+  return partition;
+}
+
+TEST(AMostBalancedMinimumCut, IsIndependentOfTheNumberOfThreads) {
+  ASSERT_EQ(mostBalancedMinimumCutOfLadder(1), mostBalancedMinimumCutOfLadder(4));
+}
 }  // namespace kahypar
@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/refinement/parallel_kway_fm_km1_refiner.h"
+#include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+
+using ::testing::Eq;
+using ::testing::Le;
+using ::testing::Test;
+
+namespace kahypar {
+using ParallelKWayKMinusOneRefinerSimpleStopping =
+  ParallelKWayKMinusOneRefiner<NumberOfFruitlessMovesStopsSearch>;
+
+class AParallelKWayKMinusOneRefiner : public Test {
+ public:
+  AParallelKWayKMinusOneRefiner() :
+    hypergraph(io::createHypergraphFromFile(
+                 "../../../../tests/partition/initial_partitioning/test_instances/test_instance.hgr",
+                 4)),
+    context() {
+    context.partition.k = 4;
+    context.partition.mode = Mode::direct_kway;
+    context.partition.objective = Objective::km1;
+    context.partition.epsilon = 0.03;
+    context.partition.rb_lower_k = 0;
+    context.partition.rb_upper_k = context.partition.k - 1;
+    for (PartitionID i = 0; i < context.partition.k; ++i) {
+      context.partition.perfect_balance_part_weights.push_back(
+        ceil(hypergraph.totalWeight() / static_cast<double>(context.partition.k)));
+      context.partition.max_part_weights.push_back((1 + context.partition.epsilon)
+                                                   * context.partition.perfect_balance_part_weights[i]);
+    }
+    context.local_search.fm.max_number_of_fruitless_moves = 50;
+
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, hn % context.partition.k);
+    }
+    hypergraph.initializeNumCutHyperedges();
+    Randomize::instance().setSeed(context.partition.seed);
+  }
+
+  Metrics refine(const size_t num_threads) {
+    context.partition.num_threads = num_threads;
+    ParallelKWayKMinusOneRefinerSimpleStopping refiner(hypergraph, context);
+    refiner.initialize(0);
+
+    std::vector<HypernodeID> refinement_nodes;
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      refinement_nodes.push_back(hn);
+    }
+    Metrics metrics = { metrics::hyperedgeCut(hypergraph),
+                        metrics::km1(hypergraph),
+                        metrics::imbalance(hypergraph, context) };
+    UncontractionGainChanges changes;
+    changes.representative.push_back(0);
+    changes.contraction_partner.push_back(0);
+    refiner.refine(refinement_nodes, { 0, 0 }, changes, metrics);
+    return metrics;
+  }
+
+  std::vector<PartitionID> partitionAfterRefinement(const size_t num_threads) {
+    Randomize::instance().setSeed(context.partition.seed);
+    refine(num_threads);
+    std::vector<PartitionID> partition;
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      partition.push_back(hypergraph.partID(hn));
+      if (hypergraph.partID(hn) != static_cast<PartitionID>(hn % context.partition.k)) {
+        hypergraph.changeNodePart(hn, hypergraph.partID(hn), hn % context.partition.k);
+      }
+    }
+    return partition;
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+};
+
+TEST_F(AParallelKWayKMinusOneRefiner, DoesNotWorsenTheObjective) {
+  const HyperedgeWeight initial_km1 = metrics::km1(hypergraph);
+  const Metrics metrics = refine(4);
+  ASSERT_THAT(metrics.km1, Le(initial_km1));
+  ASSERT_THAT(metrics.km1, Eq(metrics::km1(hypergraph)));
+  ASSERT_THAT(metrics.cut, Eq(metrics::hyperedgeCut(hypergraph)));
+}
+
+TEST_F(AParallelKWayKMinusOneRefiner, RespectsTheBalanceConstraint) {
+  refine(4);
+  for (PartitionID part = 0; part < context.partition.k; ++part) {
+    ASSERT_THAT(hypergraph.partWeight(part), Le(context.partition.max_part_weights[part]));
+  }
+}
+
+TEST_F(AParallelKWayKMinusOneRefiner, IsDeterministicForAFixedNumberOfThreads) {
+  ASSERT_THAT(partitionAfterRefinement(3), Eq(partitionAfterRefinement(3)));
+}
+}  // namespace kahypar
@@ -69,5 +69,34 @@ TEST(SCCs, AreComputedCorrectly) {
 
 }
 
+TEST(SCCs, AreComputedOnDeepGraphsWithoutRecursion) {
+  // Path 0 -> 1 -> ... -> n - 1
+  const NodeID num_nodes = 1000000;
+  std::vector<NodeID> first_edge;
+  std::vector<NodeID> targets;
+  for (NodeID u = 0; u < num_nodes; ++u) {
+    first_edge.push_back(targets.size());
+    if (u + 1 < num_nodes) {
+      targets.push_back(u + 1);
+    }
+  }
+  first_edge.push_back(targets.size());
+
+  StronglyConnectedComponents sccs(num_nodes);
+  std::vector<ClusterID> component;
+  ASSERT_EQ(sccs.compute(num_nodes, first_edge, targets, component), num_nodes);
+  for (NodeID u = 0; u + 1 < num_nodes; ++u) {
+    // Edges between different SCCs point to the SCC with the smaller ID
+    ASSERT_GT(component[u], component[u + 1]);
+  }
+
+  // Closing the path to a cycle yields a single SCC
+  targets.push_back(0);
+  first_edge.back() = targets.size();
+  ASSERT_EQ(sccs.compute(num_nodes, first_edge, targets, component), 1);
+  for (NodeID u = 0; u < num_nodes; ++u) {
+    ASSERT_EQ(component[u], 0);
+  }
+}
 
 } // namespace kahypar
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/utils/randomize.h"
+
+using ::testing::Eq;
+using ::testing::Ne;
+
+namespace kahypar {
+static std::vector<float> drawSequence(const int seed) {
+  Randomize::instance().setSeed(seed);
+  std::vector<float> sequence;
+  for (int i = 0; i < 10; ++i) {
+    sequence.push_back(static_cast<float>(Randomize::instance().getRandomInt(0, 1000)));
+    sequence.push_back(Randomize::instance().getRandomFloat(0.0, 1.0));
+    sequence.push_back(Randomize::instance().getNormalDistributedFloat(0.0, 1.0));
+  }
+  return sequence;
+}
+
+TEST(Randomize, ProducesTheSameSequenceAfterReseeding) {
+  const std::vector<float> first = drawSequence(42);
+  // leave the normal distribution with a cached value
+  Randomize::instance().getNormalDistributedFloat(0.0, 1.0);
+  const std::vector<float> second = drawSequence(42);
+  ASSERT_THAT(first, Eq(second));
+  ASSERT_THAT(Randomize::instance().seed(), Eq(42));
+}
+
+TEST(Randomize, UsesAnIndependentGeneratorForEachThread) {
+  const std::vector<float> expected = drawSequence(23);
+
+  Randomize::instance().setSeed(23);
+  const int first = Randomize::instance().newRandomSeed();
+  std::vector<float> other_thread_sequence;
+  std::thread other_thread([&other_thread_sequence]() {
+      other_thread_sequence = drawSequence(23);
+    });
+  other_thread.join();
+  const int second = Randomize::instance().newRandomSeed();
+
+  ASSERT_THAT(other_thread_sequence, Eq(expected));
+  Randomize::instance().setSeed(23);
+  ASSERT_THAT(Randomize::instance().newRandomSeed(), Eq(first));
+  ASSERT_THAT(Randomize::instance().newRandomSeed(), Eq(second));
+}
+
+TEST(Randomize, DerivesDeterministicSeedsForSubTasks) {
+  ASSERT_THAT(Randomize::deriveSeed(42, 0), Eq(Randomize::deriveSeed(42, 0)));
+  ASSERT_THAT(Randomize::deriveSeed(42, 0), Ne(Randomize::deriveSeed(42, 1)));
+  ASSERT_THAT(Randomize::deriveSeed(42, 0), Ne(Randomize::deriveSeed(43, 0)));
+  ASSERT_THAT(Randomize::deriveSeed(-1, 0), Ne(Randomize::deriveSeed(-1, 1)));
+  ASSERT_GE(Randomize::deriveSeed(-1, 7), 0);
+}
+}  // namespace kahypar
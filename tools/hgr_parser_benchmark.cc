@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/macros.h"
+
+using namespace kahypar;
+
+// Compares the running time of the sequential hMetis parser with the chunked
+// parser for different numbers of threads.
+int main(int argc, char* argv[]) {
+  if (argc < 2 || argc > 3) {
+    std::cout << "No .hgr file specified" << std::endl;
+    std::cout << "Usage: HgrParserBenchmark <.hgr> [max number of threads]" << std::endl;
+    exit(0);
+  }
+  const std::string hgr_filename(argv[1]);
+  const size_t max_threads = argc == 3 ? std::stoul(argv[2]) :
+                             std::max(std::thread::hardware_concurrency(), 1u);
+
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  HyperedgeWeightVector hyperedge_weights;
+  HypernodeWeightVector hypernode_weights;
+
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  io::readHypergraphFile(hgr_filename, num_hypernodes, num_hyperedges, index_vector, edge_vector,
+                         &hyperedge_weights, &hypernode_weights);
+  HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  const double sequential_time = std::chrono::duration<double>(end - start).count();
+  LOG << "readHypergraphFile:" << sequential_time << "s"
+      << V(num_hypernodes) << V(num_hyperedges) << V(edge_vector.size());
+
+  for (size_t num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+    HyperedgeIndexVector parsed_index_vector;
+    HyperedgeVector parsed_edge_vector;
+    HyperedgeWeightVector parsed_hyperedge_weights;
+    HypernodeWeightVector parsed_hypernode_weights;
+
+    start = std::chrono::high_resolution_clock::now();
+    io::parseHypergraphFile(hgr_filename, num_hypernodes, num_hyperedges, parsed_index_vector,
+                            parsed_edge_vector, &parsed_hyperedge_weights,
+                            &parsed_hypernode_weights, num_threads);
+    end = std::chrono::high_resolution_clock::now();
+    const double time = std::chrono::duration<double>(end - start).count();
+
+    const bool equal = parsed_index_vector == index_vector &&
+                       parsed_edge_vector == edge_vector &&
+                       parsed_hyperedge_weights == hyperedge_weights &&
+                       parsed_hypernode_weights == hypernode_weights;
+    LOG << "parseHypergraphFile:" << V(num_threads) << time << "s"
+        << "speedup=" << sequential_time / time << V(equal);
+    if (!equal) {
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "kahypar/datastructure/adaptive_gain_queue.h"
+#include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/bucket_queue.h"
+#include "kahypar/datastructure/kway_priority_queue.h"
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/macros.h"
+#include "kahypar/utils/randomize.h"
+
+using namespace kahypar;
+
+using GainMetaKey = std::numeric_limits<Gain>;
+using HeapPQ = ds::KWayPriorityQueue<HypernodeID, Gain, GainMetaKey, false,
+                                     ds::BinaryMaxHeap<HypernodeID, Gain> >;
+using EnhancedBucketPQ = ds::KWayPriorityQueue<HypernodeID, Gain, GainMetaKey, false,
+                                               ds::EnhancedBucketQueue<HypernodeID, Gain,
+                                                                       GainMetaKey> >;
+using LinkedBucketPQ = ds::KWayPriorityQueue<HypernodeID, Gain, GainMetaKey, false,
+                                             ds::LinkedBucketQueue<HypernodeID, Gain,
+                                                                   GainMetaKey> >;
+
+enum class Operation : uint8_t {
+  insert,
+  update_key,
+  remove,
+  delete_max
+};
+
+struct TraceElement {
+  Operation op;
+  HypernodeID hn;
+  PartitionID part;
+  Gain gain;
+};
+
+static Gain km1Gain(const Hypergraph& hg, const HypernodeID hn, const PartitionID to) {
+  const PartitionID from = hg.partID(hn);
+  Gain gain = 0;
+  for (const HyperedgeID& he : hg.incidentEdges(hn)) {
+    if (hg.pinCountInPart(he, from) == 1) {
+      gain += hg.edgeWeight(he);
+    }
+    if (hg.pinCountInPart(he, to) == 0) {
+      gain -= hg.edgeWeight(he);
+    }
+  }
+  return gain;
+}
+
+static bool isAdjacent(const Hypergraph& hg, const HypernodeID hn, const PartitionID part) {
+  for (const HyperedgeID& he : hg.incidentEdges(hn)) {
+    if (hg.pinCountInPart(he, part) > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Records the priority queue operations of a single unconstrained k-way FM pass for the
+// km1 metric that moves every hypernode at most once.
+static std::vector<TraceElement> recordFMTrace(Hypergraph& hg, const PartitionID k) {
+  std::vector<TraceElement> trace;
+  std::vector<bool> moved(hg.initialNumNodes(), false);
+  HeapPQ pq(k);
+  pq.initialize(hg.initialNumNodes());
+
+  const auto update_moves = [&](const HypernodeID hn) {
+      for (PartitionID part = 0; part < k; ++part) {
+        if (part == hg.partID(hn)) {
+          continue;
+        }
+        const bool adjacent = isAdjacent(hg, hn, part);
+        if (adjacent && pq.contains(hn, part)) {
+          // The refiners only perform delta-gain updates for non-zero deltas.
+          const Gain gain = km1Gain(hg, hn, part);
+          if (gain != pq.key(hn, part)) {
+            pq.updateKey(hn, part, gain);
+            trace.push_back({ Operation::update_key, hn, part, gain });
+          }
+        } else if (adjacent) {
+          const Gain gain = km1Gain(hg, hn, part);
+          pq.insert(hn, part, gain);
+          pq.enablePart(part);
+          trace.push_back({ Operation::insert, hn, part, gain });
+        } else if (pq.contains(hn, part)) {
+          pq.remove(hn, part);
+          trace.push_back({ Operation::remove, hn, part, 0 });
+        }
+      }
+    };
+
+  for (const HypernodeID& hn : hg.nodes()) {
+    if (hg.isBorderNode(hn)) {
+      update_moves(hn);
+    }
+  }
+
+  while (!pq.empty()) {
+    HypernodeID hn = 0;
+    Gain gain = 0;
+    PartitionID to = Hypergraph::kInvalidPartition;
+    pq.deleteMax(hn, gain, to);
+    trace.push_back({ Operation::delete_max, hn, to, gain });
+    for (PartitionID part = 0; part < k; ++part) {
+      if (pq.contains(hn, part)) {
+        pq.remove(hn, part);
+        trace.push_back({ Operation::remove, hn, part, 0 });
+      }
+    }
+    moved[hn] = true;
+    if (hg.partSize(hg.partID(hn)) > 1) {
+      hg.changeNodePart(hn, hg.partID(hn), to);
+    }
+    for (const HyperedgeID& he : hg.incidentEdges(hn)) {
+      for (const HypernodeID& pin : hg.pins(he)) {
+        if (!moved[pin]) {
+          update_moves(pin);
+        }
+      }
+    }
+  }
+  return trace;
+}
+
+// Replays the trace. Since the backends break ties differently, deleteMax is replayed as
+// a max query followed by the removal of the recorded element. This keeps the queue
+// contents identical for all backends.
+template <typename PQ>
+static double replay(const std::vector<TraceElement>& trace, const HypernodeID num_nodes,
+                     const PartitionID k, const Gain max_gain) {
+  PQ pq(k);
+  pq.initialize(num_nodes, max_gain);
+  Gain checksum = 0;
+  const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  for (const TraceElement& element : trace) {
+    switch (element.op) {
+      case Operation::insert:
+        pq.insert(element.hn, element.part, element.gain);
+        pq.enablePart(element.part);
+        break;
+      case Operation::update_key:
+        pq.updateKey(element.hn, element.part, element.gain);
+        break;
+      case Operation::remove:
+        pq.remove(element.hn, element.part);
+        break;
+      case Operation::delete_max:
+        checksum += pq.maxKey();
+        pq.remove(element.hn, element.part);
+        break;
+    }
+  }
+  const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  if (checksum == std::numeric_limits<Gain>::max()) {
+    std::cout << "" << std::endl;  // prevents the max queries from being optimized away
+  }
+  return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char* argv[]) {
+  if (argc < 3 || argc > 4) {
+    std::cout << "Usage: KWayPriorityQueueBenchmark <.hgr> <k> [partition file]" << std::endl;
+    std::cout << "If no partition file is given, a random partition is used." << std::endl;
+    exit(0);
+  }
+  const std::string hgr_filename(argv[1]);
+  const PartitionID k = std::stoi(argv[2]);
+  Randomize::instance().setSeed(0);
+
+  Hypergraph hypergraph(io::createHypergraphFromFile(hgr_filename, k));
+  if (argc == 4) {
+    std::vector<PartitionID> partition;
+    io::readPartitionFile(argv[3], partition);
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, partition[hn]);
+    }
+  } else {
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, Randomize::instance().getRandomInt(0, k - 1));
+    }
+  }
+  hypergraph.initializeNumCutHyperedges();
+
+  Gain max_gain = 0;
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    Gain weighted_degree = 0;
+    for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
+      weighted_degree += hypergraph.edgeWeight(he);
+    }
+    max_gain = std::max(max_gain, weighted_degree);
+  }
+
+  const std::vector<TraceElement> trace = recordFMTrace(hypergraph, k);
+  const HypernodeID num_nodes = hypergraph.initialNumNodes();
+
+  LOG << V(k) << V(max_gain) << "trace length=" << trace.size();
+  LOG << "BinaryMaxHeap       " << replay<HeapPQ>(trace, num_nodes, k, max_gain) << "s";
+  LOG << "EnhancedBucketQueue " << replay<EnhancedBucketPQ>(trace, num_nodes, k, max_gain) << "s";
+  LOG << "LinkedBucketQueue   " << replay<LinkedBucketPQ>(trace, num_nodes, k, max_gain) << "s";
+  LOG << "AdaptiveGainQueue uses buckets:"
+      << ds::AdaptiveGainQueue<HypernodeID, Gain>::usesBuckets(max_gain);
+  return 0;
+}
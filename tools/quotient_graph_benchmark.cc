@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/macros.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/refinement/flow/quotient_graph_block_scheduler.h"
+#include "kahypar/utils/randomize.h"
+
+using namespace kahypar;
+
+// Measures the time to build the quotient graph of a random k-way partition, to move
+// hypernodes to random blocks and to query the cut hyperedges of all adjacent block
+// pairs for k = 2, 4, ..., max k.
+int main(int argc, char* argv[]) {
+  if (argc < 2 || argc > 4) {
+    std::cout << "No .hgr file specified" << std::endl;
+    std::cout << "Usage: QuotientGraphBenchmark <.hgr> [max k] [number of moves]" << std::endl;
+    exit(0);
+  }
+  const std::string hgr_filename(argv[1]);
+  const PartitionID max_k = argc >= 3 ? std::stoi(argv[2]) : 4096;
+  const size_t num_moves = argc == 4 ? std::stoul(argv[3]) : 100000;
+  Randomize::instance().setSeed(0);
+
+  for (PartitionID k = 2; k <= max_k; k *= 2) {
+    Hypergraph hypergraph(io::createHypergraphFromFile(hgr_filename, k));
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      hypergraph.setNodePart(hn, Randomize::instance().getRandomInt(0, k - 1));
+    }
+    hypergraph.initializeNumCutHyperedges();
+    Context context;
+    context.partition.k = k;
+
+    HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    QuotientGraphBlockScheduler scheduler(hypergraph, context);
+    scheduler.buildQuotientGraph();
+    HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    const double build_time = std::chrono::duration<double>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < num_moves; ++i) {
+      const HypernodeID hn = Randomize::instance().getRandomInt(0, hypergraph.initialNumNodes() - 1);
+      const PartitionID to = Randomize::instance().getRandomInt(0, k - 1);
+      scheduler.changeNodePart(hn, hypergraph.partID(hn), to);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    const double move_time = std::chrono::duration<double>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    size_t num_quotient_graph_edges = 0;
+    size_t num_cut_hyperedges = 0;
+    for (const auto& e : scheduler.qoutientGraphEdges()) {
+      for (const HyperedgeID& he : scheduler.blockPairCutHyperedges(e.first, e.second)) {
+        unused(he);
+        ++num_cut_hyperedges;
+      }
+      ++num_quotient_graph_edges;
+    }
+    end = std::chrono::high_resolution_clock::now();
+    const double query_time = std::chrono::duration<double>(end - start).count();
+
+    LOG << V(k) << V(num_quotient_graph_edges) << V(num_cut_hyperedges)
+        << "build=" << build_time << "s"
+        << "moves=" << move_time << "s"
+        << "queries=" << query_time << "s";
+  }
+  return 0;
+}